@@ -34,10 +34,24 @@
  A detailed description of the different cases can be found after the code.
  */
 
+/*
+ * The start node and orientation of Gain23 are kept between calls.
+ * ResetGain23 forgets them when the node set is freed, so that a new
+ * problem can be solved in the same process (see LKHEmbed.c) and gets
+ * the same tour as in a fresh process.
+ */
+
+static Node *s1 = 0;
+static short OldReversed = 0;
+
+void ResetGain23(void)
+{
+    s1 = 0;
+    OldReversed = 0;
+}
+
 GainType Gain23(void)
 {
-    static Node *s1 = 0;
-    static short OldReversed = 0;
     Node *s2, *s3, *s4, *s5, *s6 = 0, *s7, *s8 = 0, *s1Stop;
     Candidate *Ns2, *Ns4, *Ns6;
     GainType G0, G1, G2, G3, G4, G5, G6, Gain, Gain6;
@@ -410,6 +410,7 @@ void FreeSegments(void);
 void FreeStructures(void);
 int fscanint(FILE *f, int *v);
 GainType Gain23(void);
+void ResetGain23(void);
 void GenerateCandidates(int MaxCandidates, GainType MaxAlpha, int Symmetric);
 double GetTime(void);
 GainType GreedyTour(void);
@@ -0,0 +1,80 @@
+#ifndef _LKHEMBED_H
+#define _LKHEMBED_H
+
+/*
+ * This header declares the in-process interface of LKH. It deliberately
+ * does not include LKH.h, so that it can be included from C++ code that
+ * defines its own Node type.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct LKHEmbedParameters {
+    int MoveType;       /* MOVE_TYPE */
+    int Runs;           /* RUNS */
+    int MaxTrials;      /* MAX_TRIALS */
+    unsigned Seed;      /* SEED */
+    /*
+     * If DiskR is not 0, the problem is SPECIAL instead of EUC_2D and
+     * node i is a point (X[i], Y[i]) in the disk of center
+     * (DiskX[i], DiskY[i]) and radius DiskR[i]. The weight of an edge is
+     *
+     *     PointWeight * d(points) + (1 - PointWeight) * g(disks),
+     *
+     * where g is the gap between the disks, the distance of the centers
+     * reduced by the radii, or 0 if the disks intersect.
+     */
+    const double *DiskX, *DiskY, *DiskR;
+    double PointWeight;
+} LKHEmbedParameters;
+
+/*
+ * The penalties and candidate sets of a problem, the in-memory equivalent
+ * of PI_FILE and CANDIDATE_FILE. If Given is nonzero, they are used
+ * instead of the subgradient ascent. Otherwise they are computed and
+ * stored here. Nodes are numbered from 0 to Dimension - 1.
+ */
+typedef struct LKHEmbedCandidates {
+    int Given;
+    int Width;          /* number of candidates stored per node */
+    int *Pi;            /* Pi[i]: penalty of node i */
+    int *To;            /* To[i * Width + k]: k-th candidate of node i, or -1 */
+    int *Alpha;         /* Alpha[i * Width + k]: its alpha-value */
+} LKHEmbedCandidates;
+
+void LKHEmbed_DefaultParameters(LKHEmbedParameters * Parameters);
+
+/*
+ * Solves a EUC_2D instance given by its coordinates, starting from an
+ * initial tour, and stores the best tour found in Tour.
+ * Nodes are numbered from 0 to Dimension - 1 in both tours.
+ * Candidates may be 0.
+ * The edges FixedEdge[2 * i], FixedEdge[2 * i + 1], i < FixedEdges, are
+ * fixed as with FIXED_EDGES_SECTION. They should be edges of the initial
+ * tour. Fixes that would give a node more than two fixed edges or close a
+ * subtour are ignored.
+ * Returns the cost of the tour found, in which fixed edges cost nothing.
+ */
+long long LKHEmbed_Solve(int Dimension, const double *X, const double *Y,
+                         const int *InitialTour, int *Tour,
+                         const LKHEmbedParameters * Parameters,
+                         LKHEmbedCandidates * Candidates,
+                         int FixedEdges, const int *FixedEdge);
+
+/*
+ * Recombines two tours of a EUC_2D instance with the Generalized Partition
+ * Crossover 2 of gpx.c and stores the offspring in Offspring. Nodes are
+ * numbered from 0 to Dimension - 1 in all tours. The offspring consists
+ * of edges of the parents only and is not longer than the shorter parent.
+ * Returns the cost of the offspring.
+ */
+long long LKHEmbed_GPX(int Dimension, const double *X, const double *Y,
+                       const int *TourA, const int *TourB, int *Offspring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,513 @@
+#include "LKH.h"
+#include "Heap.h"
+#include "Genetic.h"
+#include "gpx.h"
+#include "LKHEmbed.h"
+
+/*
+ * This file contains the in-process interface of LKH.
+ *
+ * LKHEmbed_Solve performs the same steps as the main program for a
+ * parameter file containing
+ *
+ *     MOVE_TYPE, RUNS, MAX_TRIALS, SEED and TRACE_LEVEL = 0,
+ *
+ * a EUC_2D problem file with a NODE_COORD_SECTION, and an INITIAL_TOUR_FILE,
+ * but takes its input from memory and returns the best tour in memory.
+ * No files are read or written. Penalties and candidate sets may be
+ * passed in and out as with PI_FILE and CANDIDATE_FILE. With disks, the
+ * problem is SPECIAL and its weights are given by Distance_DISK.
+ *
+ * LKH keeps its state in global variables, so the function is not
+ * re-entrant. Callers must serialize the calls.
+ */
+
+static const double *DiskX, *DiskY, *DiskR;
+static double PointWeight;
+
+static void SetParameters(const LKHEmbedParameters * Parameters);
+static int Distance_DISK(Node * Na, Node * Nb);
+static void CreateProblem(int Dimension, const double *X, const double *Y,
+                          const int *InitialTour);
+static int FixEdge(Node * Na, Node * Nb);
+static void AdjustParameters(void);
+static void CreateGivenCandidateSet(const LKHEmbedCandidates * Candidates);
+static void StoreCandidateSet(LKHEmbedCandidates * Candidates);
+
+void LKHEmbed_DefaultParameters(LKHEmbedParameters * Parameters)
+{
+    Parameters->MoveType = 5;
+    Parameters->Runs = 1;
+    Parameters->MaxTrials = 10;
+    Parameters->Seed = 1;
+    Parameters->DiskX = Parameters->DiskY = Parameters->DiskR = 0;
+    Parameters->PointWeight = 1;
+}
+
+long long LKHEmbed_Solve(int Dim, const double *X, const double *Y,
+                         const int *InitialTour, int *Tour,
+                         const LKHEmbedParameters * Parameters,
+                         LKHEmbedCandidates * Candidates,
+                         int FixedEdges, const int *FixedEdge)
+{
+    GainType Cost;
+    int i;
+
+    SetParameters(Parameters);
+    StartTime = GetTime();
+    MaxMatrixDimension = 20000;
+    MergeWithTour = MergeWithTourIPT;
+    CreateProblem(Dim, X, Y, InitialTour);
+    if (DiskR) {
+        /* c_EUC_2D is no lower bound of the disk weights */
+        WeightType = SPECIAL;
+        Distance = Distance_DISK;
+        c = 0;
+    }
+    for (i = 0; i < FixedEdges; i++)
+        if (FixedEdge[2 * i] >= 0 && FixedEdge[2 * i] < Dim &&
+            FixedEdge[2 * i + 1] >= 0 && FixedEdge[2 * i + 1] < Dim)
+            FixEdge(&NodeSet[FixedEdge[2 * i] + 1],
+                    &NodeSet[FixedEdge[2 * i + 1] + 1]);
+    AdjustParameters();
+
+    AllocateStructures();
+    if (Candidates && Candidates->Given)
+        CreateGivenCandidateSet(Candidates);
+    else {
+        CreateCandidateSet();
+        if (Candidates)
+            StoreCandidateSet(Candidates);
+    }
+
+    if (Norm != 0)
+        BestCost = PLUS_INFINITY;
+    else {
+        /* The ascent has solved the problem! */
+        BestCost = (GainType) LowerBound;
+        RecordBetterTour();
+        RecordBestTour();
+        Runs = 0;
+    }
+
+    for (Run = 1; Run <= Runs; Run++) {
+        Cost = FindTour();
+        if (Run > 1)
+            Cost = MergeTourWithBestTour();
+        if (Cost < BestCost) {
+            BestCost = Cost;
+            RecordBetterTour();
+            RecordBestTour();
+        }
+        SRandom(++Seed);
+    }
+
+    for (i = 0; i < Dimension; i++)
+        Tour[i] = BestTour[i + 1] - 1;
+    Cost = BestCost;
+    FreeStructures();
+    ResetGain23();
+    FirstNode = 0;
+    return Cost;
+}
+
+/*
+ * LKHEmbed_GPX sets up the problem without any candidate sets or cost
+ * matrix, so that the weights used by gpx.c are computed directly by the
+ * distance function.
+ */
+
+long long LKHEmbed_GPX(int Dim, const double *X, const double *Y,
+                       const int *TourA, const int *TourB, int *Offspring)
+{
+    GainType Cost;
+    int i, *Blue, *Red;
+
+    SetParameters(0);
+    CreateProblem(Dim, X, Y, 0);
+    Scale = 1;
+    C = C_FUNCTION;
+    D = D_FUNCTION;
+    PredSucCostAvailable = 0;
+    n_cities = Dim;
+    Map2Node = (Node **) malloc(Dim * sizeof(Node *));
+    Blue = (int *) malloc(Dim * sizeof(int));
+    Red = (int *) malloc(Dim * sizeof(int));
+    for (i = 0; i < Dim; i++) {
+        Map2Node[i] = &NodeSet[i + 1];
+        Blue[i] = TourA[i];
+        Red[i] = TourB[i];
+    }
+    Cost = gpx(Blue, Red, Offspring);
+    free(Blue);
+    free(Red);
+    free(Map2Node);
+    Map2Node = 0;
+    FreeStructures();
+    FirstNode = 0;
+    return Cost;
+}
+
+/*
+ * The SetParameters function sets the default values of ReadParameters
+ * and overrides those given by the caller.
+ */
+
+static void SetParameters(const LKHEmbedParameters * Parameters)
+{
+    ProblemFileName = PiFileName = InputTourFileName =
+        OutputTourFileName = TourFileName = InitialTourFileName = 0;
+    SubproblemTourFileName = 0;
+    CandidateFiles = MergeTourFiles = 0;
+    AscentCandidates = 50;
+    BackboneTrials = 0;
+    Backtracking = 0;
+    CandidateSetSymmetric = 0;
+    CandidateSetType = ALPHA;
+    Crossover = ERXT;
+    DelaunayPartitioning = 0;
+    DelaunayPure = 0;
+    Excess = -1;
+    ExtraCandidates = 0;
+    ExtraCandidateSetSymmetric = 0;
+    ExtraCandidateSetType = QUADRANT;
+    Gain23Used = 1;
+    GainCriterionUsed = 1;
+    GridSize = 1000000.0;
+    InitialPeriod = -1;
+    InitialStepSize = 0;
+    InitialTourAlgorithm = WALK;
+    InitialTourFraction = 1.0;
+    KarpPartitioning = 0;
+    KCenterPartitioning = 0;
+    KMeansPartitioning = 0;
+    Kicks = 1;
+    KickType = 0;
+    MaxBreadth = INT_MAX;
+    MaxCandidates = 5;
+    MaxPopulationSize = 0;
+    MaxSwaps = -1;
+    MaxTrials = -1;
+    MoorePartitioning = 0;
+    MoveType = 5;
+    NonsequentialMoveType = -1;
+    Optimum = MINUS_INFINITY;
+    PatchingA = 1;
+    PatchingC = 0;
+    PatchingAExtended = 0;
+    PatchingARestricted = 0;
+    PatchingCExtended = 0;
+    PatchingCRestricted = 0;
+    Precision = 100;
+    POPMUSIC_InitialTour = 0;
+    POPMUSIC_MaxNeighbors = 5;
+    POPMUSIC_SampleSize = 10;
+    POPMUSIC_Solutions = 50;
+    POPMUSIC_Trials = 1;
+    Recombination = IPT;
+    RestrictedSearch = 1;
+    RohePartitioning = 0;
+    Runs = 0;
+    Scale = -1;
+    Seed = 1;
+    SierpinskiPartitioning = 0;
+    StopAtOptimum = 1;
+    Subgradient = 1;
+    SubproblemBorders = 0;
+    SubproblemsCompressed = 0;
+    SubproblemSize = 0;
+    SubsequentMoveType = 0;
+    SubsequentPatching = 1;
+    TimeLimit = DBL_MAX;
+    TotalTimeLimit = DBL_MAX;
+    TraceLevel = 0;
+
+    DiskX = DiskY = DiskR = 0;
+    PointWeight = 1;
+
+    if (Parameters) {
+        MoveType = Parameters->MoveType;
+        Runs = Parameters->Runs;
+        MaxTrials = Parameters->MaxTrials;
+        Seed = Parameters->Seed;
+        DiskX = Parameters->DiskX;
+        DiskY = Parameters->DiskY;
+        DiskR = Parameters->DiskR;
+        PointWeight = Parameters->PointWeight;
+    }
+}
+
+/*
+ * The Distance_DISK function is the SPECIAL distance of a problem with
+ * disks. It blends the distance of the current points with the gap
+ * between the disks of the two nodes.
+ */
+
+static int Distance_DISK(Node * Na, Node * Nb)
+{
+    int a = Na->Id - 1, b = Nb->Id - 1;
+    double xd = Na->X - Nb->X, yd = Na->Y - Nb->Y;
+    double Point = sqrt(xd * xd + yd * yd), Gap;
+
+    xd = DiskX[a] - DiskX[b];
+    yd = DiskY[a] - DiskY[b];
+    Gap = sqrt(xd * xd + yd * yd) - DiskR[a] - DiskR[b];
+    if (Gap < 0)
+        Gap = 0;
+    return (int) (Scale * (PointWeight * Point + (1 - PointWeight) * Gap) +
+                  0.5);
+}
+
+/*
+ * The CreateProblem function creates the nodes of a EUC_2D problem in the
+ * same way as ReadProblem does for a NODE_COORD_SECTION, and links them
+ * in the order of the initial tour.
+ */
+
+static void CreateProblem(int Dim, const double *X, const double *Y,
+                          const int *InitialTour)
+{
+    Node *Prev = 0, *N = 0, *First, *Last;
+    int i;
+
+    FreeStructures();
+    FirstNode = 0;
+    ProblemType = TSP;
+    WeightType = EUC_2D;
+    WeightFormat = -1;
+    CoordType = TWOD_COORDS;
+    Name = Type = EdgeWeightType = EdgeWeightFormat = 0;
+    EdgeDataFormat = NodeCoordType = DisplayDataType = 0;
+    Distance = Distance_EUC_2D;
+    c = c_EUC_2D;
+    C = 0;
+    Dimension = DimensionSaved = Dim;
+
+    NodeSet = (Node *) calloc(Dimension + 1, sizeof(Node));
+    for (i = 1; i <= Dimension; i++, Prev = N) {
+        N = &NodeSet[i];
+        if (i == 1)
+            FirstNode = N;
+        else
+            Link(Prev, N);
+        N->Id = i;
+        N->X = X[i - 1];
+        N->Y = Y[i - 1];
+    }
+    Link(N, FirstNode);
+
+    if (InitialTour) {
+        First = Last = &NodeSet[InitialTour[0] + 1];
+        for (i = 1; i < Dimension; i++) {
+            N = &NodeSet[InitialTour[i] + 1];
+            Last->InitialSuc = N;
+            Last = N;
+        }
+        Last->InitialSuc = First;
+    }
+    Swaps = 0;
+}
+
+/*
+ * The FixEdge function fixes the edge (Na, Nb) as Read_FIXED_EDGES_SECTION
+ * does, but ignores the fix instead of terminating if it is illegal.
+ */
+
+static int FixEdge(Node * Na, Node * Nb)
+{
+    Node *N = Na, *NPrev = 0, *NNext;
+    int Count = 1;
+
+    if (Na == Nb || Fixed(Na, Nb))
+        return Na != Nb;
+    if ((Na->FixedTo1 && Na->FixedTo2) || (Nb->FixedTo1 && Nb->FixedTo2))
+        return 0;
+    /* Cycle check: Nb must not be the other end of the fixed path of Na */
+    while ((NNext = N->FixedTo1 != NPrev ? N->FixedTo1 : N->FixedTo2)) {
+        NPrev = N;
+        N = NNext;
+        Count++;
+    }
+    if (N == Nb && Count != Dimension)
+        return 0;
+    if (!Na->FixedTo1)
+        Na->FixedTo1 = Nb;
+    else
+        Na->FixedTo2 = Nb;
+    if (!Nb->FixedTo1)
+        Nb->FixedTo1 = Na;
+    else
+        Nb->FixedTo2 = Na;
+    return 1;
+}
+
+/*
+ * The AdjustParameters function is a copy of the parameter adjustments
+ * made at the end of ReadProblem.
+ */
+
+static void AdjustParameters(void)
+{
+    int K;
+
+    if (Seed == 0)
+        Seed = (unsigned) (time(0) * (size_t) (&Seed));
+    if (Precision == 0)
+        Precision = 100;
+    if (InitialStepSize == 0)
+        InitialStepSize = 1;
+    if (MaxSwaps < 0)
+        MaxSwaps = Dimension;
+    if (KickType > Dimension / 2)
+        KickType = Dimension / 2;
+    if (Runs == 0)
+        Runs = 10;
+    if (MaxCandidates > Dimension - 1)
+        MaxCandidates = Dimension - 1;
+    if (ExtraCandidates > Dimension - 1)
+        ExtraCandidates = Dimension - 1;
+    if (Scale < 1)
+        Scale = 1;
+    if (AscentCandidates > Dimension - 1)
+        AscentCandidates = Dimension - 1;
+    if (InitialPeriod < 0) {
+        InitialPeriod = Dimension / 2;
+        if (InitialPeriod < 100)
+            InitialPeriod = 100;
+    }
+    if (Excess < 0)
+        Excess = 1.0 / DimensionSaved;
+    if (MaxTrials == -1)
+        MaxTrials = Dimension;
+    HeapMake(Dimension);
+    if (POPMUSIC_MaxNeighbors > Dimension - 1)
+        POPMUSIC_MaxNeighbors = Dimension - 1;
+    if (POPMUSIC_SampleSize > Dimension)
+        POPMUSIC_SampleSize = Dimension;
+    if (CostMatrix == 0 && Dimension <= MaxMatrixDimension) {
+        Node *Ni, *Nj;
+        CostMatrix = (int *) calloc((size_t) Dimension * (Dimension - 1) / 2,
+                                    sizeof(int));
+        Ni = FirstNode->Suc;
+        do {
+            Ni->C =
+                &CostMatrix[(size_t) (Ni->Id - 1) * (Ni->Id - 2) / 2] - 1;
+            for (Nj = FirstNode; Nj != Ni; Nj = Nj->Suc)
+                Ni->C[Nj->Id] = Fixed(Ni, Nj) ? 0 : Distance(Ni, Nj);
+        }
+        while ((Ni = Ni->Suc) != FirstNode);
+        WeightType = EXPLICIT;
+        c = 0;
+    }
+    C = WeightType == EXPLICIT ? C_EXPLICIT : C_FUNCTION;
+    D = WeightType == EXPLICIT ? D_EXPLICIT : D_FUNCTION;
+    if (SubsequentMoveType == 0)
+        SubsequentMoveType = MoveType;
+    K = MoveType >= SubsequentMoveType
+        || !SubsequentPatching ? MoveType : SubsequentMoveType;
+    if (PatchingC > K)
+        PatchingC = K;
+    if (PatchingA > 1 && PatchingA >= PatchingC)
+        PatchingA = PatchingC > 2 ? PatchingC - 1 : 1;
+    if (NonsequentialMoveType == -1 ||
+        NonsequentialMoveType > K + PatchingC + PatchingA - 1)
+        NonsequentialMoveType = K + PatchingC + PatchingA - 1;
+    if (PatchingC >= 1) {
+        BestMove = BestSubsequentMove = BestKOptMove;
+        if (!SubsequentPatching && SubsequentMoveType <= 5) {
+            MoveFunction BestOptMove[] =
+                { 0, 0, Best2OptMove, Best3OptMove,
+                Best4OptMove, Best5OptMove
+            };
+            BestSubsequentMove = BestOptMove[SubsequentMoveType];
+        }
+    } else {
+        MoveFunction BestOptMove[] = { 0, 0, Best2OptMove, Best3OptMove,
+            Best4OptMove, Best5OptMove
+        };
+        BestMove = MoveType <= 5 ? BestOptMove[MoveType] : BestKOptMove;
+        BestSubsequentMove = SubsequentMoveType <= 5 ?
+            BestOptMove[SubsequentMoveType] : BestKOptMove;
+    }
+}
+
+/*
+ * The CreateGivenCandidateSet function replaces CreateCandidateSet when
+ * the penalties and candidate sets are known. It follows the branch of
+ * CreateCandidateSet for a PI_FILE and a CANDIDATE_FILE.
+ */
+
+static void CreateGivenCandidateSet(const LKHEmbedCandidates * Candidates)
+{
+    Node *Na;
+    int i, k, To;
+
+    Norm = 9999;
+    if (C == C_EXPLICIT) {
+        Na = FirstNode;
+        do {
+            for (i = 1; i < Na->Id; i++)
+                Na->C[i] *= Precision;
+        }
+        while ((Na = Na->Suc) != FirstNode);
+    }
+    for (i = 1; i <= Dimension; i++)
+        NodeSet[i].Pi = Candidates->Pi[i - 1];
+    for (i = 1; i <= Dimension; i++) {
+        Na = &NodeSet[i];
+        for (k = 0; k < Candidates->Width; k++) {
+            To = Candidates->To[(i - 1) * Candidates->Width + k];
+            if (To >= 0 && To + 1 != i)
+                AddCandidate(Na, &NodeSet[To + 1], D(Na, &NodeSet[To + 1]),
+                             Candidates->Alpha[(i - 1) * Candidates->Width +
+                                               k]);
+        }
+    }
+    ResetCandidateSet();
+    if (MaxCandidates > 0)
+        TrimCandidateSet(MaxCandidates);
+    AddTourCandidates();
+    if (CandidateSetSymmetric)
+        SymmetrizeCandidateSet();
+    ResetCandidateSet();
+    if (C == C_EXPLICIT) {
+        Na = FirstNode;
+        do
+            for (i = 1; i < Na->Id; i++)
+                Na->C[i] += Na->Pi + NodeSet[i].Pi;
+        while ((Na = Na->Suc) != FirstNode);
+    }
+}
+
+/*
+ * The StoreCandidateSet function stores the penalties and the candidate
+ * sets computed by CreateCandidateSet, as WritePenalties and
+ * WriteCandidates do. Edges of the initial tour that were added by
+ * AddTourCandidates (Alpha = 1) are left out, since they belong to this
+ * tour only.
+ */
+
+static void StoreCandidateSet(LKHEmbedCandidates * Candidates)
+{
+    Candidate *NN;
+    Node *N;
+    int i, k;
+
+    for (i = 1; i <= Dimension; i++) {
+        N = &NodeSet[i];
+        Candidates->Pi[i - 1] = N->Pi;
+        k = 0;
+        for (NN = N->CandidateSet;
+             NN && NN->To && k < Candidates->Width; NN++) {
+            if (NN->Alpha == 1 &&
+                (N->InitialSuc == NN->To || NN->To->InitialSuc == N))
+                continue;
+            Candidates->To[(i - 1) * Candidates->Width + k] = NN->To->Id - 1;
+            Candidates->Alpha[(i - 1) * Candidates->Width + k++] = NN->Alpha;
+        }
+        for (; k < Candidates->Width; k++) {
+            Candidates->To[(i - 1) * Candidates->Width + k] = -1;
+            Candidates->Alpha[(i - 1) * Candidates->Width + k] = 0;
+        }
+    }
+}
@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "LKHEmbed.h"
+
+/*
+ * This file contains the main function of the LKH worker, a long-lived
+ * LKH process that solves one problem after the other. Problems and
+ * initial tours are read from standard input and the best tours are
+ * written to standard output, so no files are used.
+ *
+ * Request:
+ *
+ *     SOLVE <Dimension> <MoveType> <Runs> <MaxTrials> <Seed> <Candidates>
+ *           <FixedEdges> <Disks>
+ *     <X> <Y>                            (one line per node, node 0 first)
+ *     <Tour[0]> ... <Tour[Dimension-1]>  (initial tour)
+ *     [candidate section]                (if Candidates = 1)
+ *     <From> <To>                        (one line per fixed edge)
+ *     [disk section]                     (if Disks = 1)
+ *
+ * Response:
+ *
+ *     TOUR <Dimension> <Cost>
+ *     <Tour[0]> ... <Tour[Dimension-1]>
+ *     [candidate section]                (if Candidates = 2)
+ *
+ * Candidates is 0 if no penalties and candidate sets are exchanged, 1 if
+ * they are given, and 2 if the computed ones are wanted. The candidate
+ * section is the line <Width>, followed by one line per node:
+ *
+ *     <Pi> <To[0]> <Alpha[0]> ... <To[Width-1]> <Alpha[Width-1]>
+ *
+ * Nodes are numbered from 0 to Dimension - 1, and a missing candidate is
+ * -1. The disk section is the line <PointWeight>, followed by one line
+ * <DiskX> <DiskY> <DiskR> per node (see LKHEmbedParameters).
+ * The worker terminates on QUIT or end of input.
+ */
+
+int main(void)
+{
+    char Command[16];
+    int Dimension, Capacity = 0, Mode, FixedEdges, Disks, i, k;
+    double *X = 0, *Y = 0, *DiskX = 0, *DiskY = 0, *DiskR = 0;
+    int *InitialTour = 0, *Tour = 0, *FixedEdge = 0;
+    long long Cost;
+    LKHEmbedParameters Parameters;
+    LKHEmbedCandidates Candidates = { 0, 0, 0, 0, 0 };
+
+    while (scanf("%15s", Command) == 1 && strcmp(Command, "QUIT")) {
+        LKHEmbed_DefaultParameters(&Parameters);
+        if (strcmp(Command, "SOLVE") ||
+            scanf("%d %d %d %d %u %d %d %d", &Dimension, &Parameters.MoveType,
+                  &Parameters.Runs, &Parameters.MaxTrials,
+                  &Parameters.Seed, &Mode, &FixedEdges, &Disks) != 8 ||
+            Dimension < 0 || FixedEdges < 0 || FixedEdges > Dimension) {
+            fprintf(stderr, "LKH worker: bad request\n");
+            return EXIT_FAILURE;
+        }
+        if (Dimension > Capacity) {
+            Capacity = Dimension;
+            X = (double *) realloc(X, Capacity * sizeof(double));
+            Y = (double *) realloc(Y, Capacity * sizeof(double));
+            DiskX = (double *) realloc(DiskX, Capacity * sizeof(double));
+            DiskY = (double *) realloc(DiskY, Capacity * sizeof(double));
+            DiskR = (double *) realloc(DiskR, Capacity * sizeof(double));
+            InitialTour = (int *) realloc(InitialTour, Capacity * sizeof(int));
+            Tour = (int *) realloc(Tour, Capacity * sizeof(int));
+            FixedEdge =
+                (int *) realloc(FixedEdge, 2 * Capacity * sizeof(int));
+        }
+        for (i = 0; i < Dimension; i++)
+            if (scanf("%lf %lf", &X[i], &Y[i]) != 2)
+                return EXIT_FAILURE;
+        for (i = 0; i < Dimension; i++)
+            if (scanf("%d", &InitialTour[i]) != 1 ||
+                InitialTour[i] < 0 || InitialTour[i] >= Dimension)
+                return EXIT_FAILURE;
+        if (Mode == 1) {
+            if (scanf("%d", &Candidates.Width) != 1 || Candidates.Width < 0)
+                return EXIT_FAILURE;
+        } else
+            Candidates.Width = 8;
+        if (Mode != 0) {
+            Candidates.Given = Mode == 1;
+            Candidates.Pi =
+                (int *) realloc(Candidates.Pi, Dimension * sizeof(int));
+            Candidates.To =
+                (int *) realloc(Candidates.To,
+                                Dimension * Candidates.Width * sizeof(int));
+            Candidates.Alpha =
+                (int *) realloc(Candidates.Alpha,
+                                Dimension * Candidates.Width * sizeof(int));
+        }
+        for (i = 0; Mode == 1 && i < Dimension; i++) {
+            if (scanf("%d", &Candidates.Pi[i]) != 1)
+                return EXIT_FAILURE;
+            for (k = i * Candidates.Width; k < (i + 1) * Candidates.Width;
+                 k++)
+                if (scanf("%d %d", &Candidates.To[k],
+                          &Candidates.Alpha[k]) != 2 ||
+                    Candidates.To[k] >= Dimension)
+                    return EXIT_FAILURE;
+        }
+        for (i = 0; i < 2 * FixedEdges; i++)
+            if (scanf("%d", &FixedEdge[i]) != 1)
+                return EXIT_FAILURE;
+        if (Disks) {
+            if (scanf("%lf", &Parameters.PointWeight) != 1)
+                return EXIT_FAILURE;
+            for (i = 0; i < Dimension; i++)
+                if (scanf("%lf %lf %lf", &DiskX[i], &DiskY[i], &DiskR[i]) !=
+                    3)
+                    return EXIT_FAILURE;
+            Parameters.DiskX = DiskX;
+            Parameters.DiskY = DiskY;
+            Parameters.DiskR = DiskR;
+        }
+        if (Dimension < 4) {
+            /* Nothing to improve */
+            memcpy(Tour, InitialTour, Dimension * sizeof(int));
+            Cost = 0;
+            Mode = 0;
+        } else
+            Cost = LKHEmbed_Solve(Dimension, X, Y, InitialTour, Tour,
+                                  &Parameters, Mode ? &Candidates : 0,
+                                  FixedEdges, FixedEdge);
+        printf("TOUR %d %lld\n", Dimension, Cost);
+        for (i = 0; i < Dimension; i++)
+            printf(i + 1 < Dimension ? "%d " : "%d", Tour[i]);
+        printf("\n");
+        if (Mode == 2) {
+            printf("%d\n", Candidates.Width);
+            for (i = 0; i < Dimension; i++) {
+                printf("%d", Candidates.Pi[i]);
+                for (k = i * Candidates.Width;
+                     k < (i + 1) * Candidates.Width; k++)
+                    printf(" %d %d", Candidates.To[k], Candidates.Alpha[k]);
+                printf("\n");
+            }
+        }
+        fflush(stdout);
+    }
+    free(X);
+    free(Y);
+    free(DiskX);
+    free(DiskY);
+    free(DiskR);
+    free(InitialTour);
+    free(Tour);
+    free(FixedEdge);
+    free(Candidates.Pi);
+    free(Candidates.To);
+    free(Candidates.Alpha);
+    return EXIT_SUCCESS;
+}
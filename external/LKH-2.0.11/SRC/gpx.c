@@ -1218,8 +1218,8 @@ void testComp(int cand)
 
                 // Comparing the two graphs                                     
                 test[cand] = isequal(Gs_blue, Gs_red);
-                free(Gs_red);
-                free(Gs_blue);
+                freeGraph(Gs_red);
+                freeGraph(Gs_blue);
                 free(inp_out_blue_inv);
                 free(inp_out_red);
             }
@@ -1560,7 +1560,7 @@ void fusionB(int *sol_blue, int *sol_red)
 
         free(vector_new_cand);
     }
-    free(G_cand);
+    freeGraph(G_cand);
     free(cand_seq);
     free(cand_seq_cut);
     free(new_label);
@@ -18,6 +18,8 @@ const int ITERATION = 200;             // max iteration
 const double MAX_TIME = 36000;          // max running time
 const int POPULATION_SIZE = 20;         // population size
 const int DISTANCE_THRESHOLD = 5;       // min distance in population
+const bool PRUNE = false;               // skip the exact solve of offspring whose lower bound cannot enter the population
+const bool ADAPTIVE_PRECISION = false;   // solve offspring coarsely, and tightly only those that may beat the best solution
 const double FIT_BETA = 0.96;           // fitness function distance coef
 const int NEIGHBOR_SIZE = 50;           // neighbors size of a target
 const double EPSILON = 1e-4;            // approximation in geometry and local search
@@ -32,10 +34,57 @@ const double ML_THRESHOLD = 3;
 
 const std::string INITIALIZATION = "KMEANS";    // RANDOM, KMEANS
 const std::string SELECTION = "RANDOM";         // RANDOM, ROULETTE
-const std::string CROSSOVER = "KSX";            // KSX, GAX, EAX
+const std::string CROSSOVER = "KSX";            // KSX, GAX, EAX, GPX
 const std::string IMPROVEMENT = "BEST";         // FIRST, BEST
 const std::string GREEDY_ALGO = "SQUEEZE";      // SQUEEZE, SPARSE
 const std::string DISTANCE = "EDIT";
+const std::string LKH_BACKEND = "LIB";          // LIB, FILE, POOL
+const int LKH_WORKERS = 4;                      // worker processes of the POOL backend
+const bool LKH_FIX_EDGES = false;               // keep edge runs common to both parents fixed when LKH improves an offspring
+const int LKH_FIX_MARGIN = 2;                   // edges left free at both ends of a fixed run
+const bool LKH_ADAPTIVE = false;                // choose MOVE_TYPE, RUNS and MAX_TRIALS per call from the measured gain per second
+const int LKH_EFFORT_WINDOW = 8;                // LKH calls between two effort decisions
+const double LKH_EFFORT_SMOOTH = 0.3;           // weight of the last call in the smoothed gain per second
+const double LKH_EFFORT_CHANGE = 0.25;          // fraction of free edges from which an offspring gets all trials
+const std::string LKH_COST = "POINT";           // POINT: LKH sees the turning points, DISK: blended with the gaps between the disks
+const double LKH_POINT_WEIGHT = 0.5;            // weight of the turning points in the DISK cost
+// turning points of a sequence: GUROBI (needs CETSP_USE_GUROBI), NATIVE (interior point), BAND (warm-started first order, then NATIVE), DP (approximate, sampled angles)
+#ifdef CETSP_USE_GUROBI
+const std::string SOLVER_BACKEND = "GUROBI";    // builds with Gurobi keep it, NATIVE is opt-in
+#else
+const std::string SOLVER_BACKEND = "NATIVE";
+#endif
+const double SOLVER_TOLERANCE = 1e-7;           // NATIVE: bound on the gap relative to the start length
+const double SOLVER_GUROBI_TOLERANCE = 1e-6;    // GUROBI: barrier tolerance of the tight solves, its default
+const double SOLVER_COARSE_TOLERANCE = 1e-3;    // adaptive precision: tolerance of the offspring the population does not keep
+const double SOLVER_MU_START = 0.1;             // NATIVE: first barrier weight, relative to the mean edge length
+const double SOLVER_MU_DECREASE = 0.1;          // NATIVE: barrier weight decrease between two centerings
+const double SOLVER_CENTERING = 1e-1;           // NATIVE: squared Newton decrement of a centered point
+const int SOLVER_MAX_NEWTON = 50;               // NATIVE: Newton steps per centering
+const double SOLVER_MIN_RADIUS = 1e-9;          // NATIVE: smaller disks are fixed points
+const double SOLVER_BAND_GAP = 1e-4;            // BAND: relative gap at which the rubber band stops
+const int SOLVER_BAND_ITERATIONS = 200;         // BAND: sweeps before NATIVE takes over
+const int SOLVER_BAND_CHECK = 10;               // BAND: sweeps between two gap checks
+const double SOLVER_BAND_STEP = 1;              // BAND: primal step relative to the mean edge length
+const int SOLVER_DP_ANGLES = 16;                // DP: boundary points sampled per disk
+const int SOLVER_DP_ROUNDS = 8;                 // DP: dynamic programs, two on the boundaries then around the points
+const int SOLVER_DP_SWEEPS = 10;                // DP: refinement sweeps after the dynamic program
+const int SOLVER_BOUND_ITERATIONS = 50;         // rubber band sweeps of the lower bound used for pruning
+const bool SOLVER_INCREMENTAL = false;          // NATIVE, BAND: re-solve only the windows that changed since a cached full solve
+const int SOLVER_WINDOW_MARGIN = 3;             // unchanged nodes re-solved on both sides of a change
+const double SOLVER_WINDOW_COVER = 0.5;         // fraction of re-solved nodes above which the whole tour is solved
+const int SOLVER_WINDOW_CACHE = 32;             // full solves kept as references
+const int SOLVER_THREADS = 0;                   // NATIVE, BAND: threads solving windows, above 1 large tours are split. GUROBI: its Threads, unset at 0
+const int SOLVER_SPLIT_MIN = 200;               // nodes from which a tour is split between the threads
+const int SOLVER_SPLIT_SWEEPS = 40;             // sweeps of the split solve
+const double SOLVER_CERTIFY_EDGE = 1e-4;        // windows, splits: edges below this fraction of the mean edge count as points in the certified gap
+const bool SOLVER_ACTIVE_SET = false;           // constrain only the disks the path does not cross, and add the violated ones
+const std::string SEQ_OPT = "LKH";              // sequence optimizer of the VND: LKH, NATIVE (2-opt and Or-opt), AUTO (NATIVE for small changes)
+const double SEQ_OPT_CHANGE = 0.05;             // fraction of offspring edges in neither parent up to which AUTO uses NATIVE
+const int SEQ_OPT_NEIGHBORS = 10;               // candidates per node of the NATIVE optimizer
+const int SEQ_OPT_TWO_LEVEL = 10000;            // nodes from which the NATIVE optimizer keeps the tour in a two-level list
+const double LKH_CACHE_TOLERANCE = -1;          // drift of turning points (relative to the diagonal) before the LKH candidates are recomputed, < 0 disables
+const int NODE_SLAB = 4096;                     // nodes allocated at once by the node pool
 
 const std::string ENV = "LOCAL";                 // LOCAL, SERVER
 const bool LOG = true;                          // log more details
@@ -50,8 +99,24 @@ const std::string SERVER_LKH_TMP_ROOT = "";
 // local
 const std::string LOCAL_DATA_DIR = "../../datasets/";
 const std::string LOCAL_RES_DIR = "../../solutions/";
+// LKH_EXE_PATH and LKH_TMP_PATH replace them in builds that come with their own LKH, like the tests
+#ifdef LKH_EXE_PATH
+const std::string LOCAL_LKH_EXE = LKH_EXE_PATH;
+#else
 const std::string LOCAL_LKH_EXE = "C:/Users/Demir/researchproject/MA-CETSP/external/LKH-2.0.11/LKH.exe";
+#endif
+#ifdef LKH_TMP_PATH
+const std::string LOCAL_LKH_TMP_ROOT = LKH_TMP_PATH;
+#else
 const std::string LOCAL_LKH_TMP_ROOT = "C:/Users/Demir/researchproject/MA-CETSP/external/LKH-2.0.11/tmp/";
+#endif
+
+// LKH worker of the POOL backend, built next to MA-CETSP
+#ifdef LKH_WORKER_PATH
+const std::string LKH_WORKER_EXE = LKH_WORKER_PATH;
+#else
+const std::string LKH_WORKER_EXE = "LKH-worker";
+#endif
 
 const std::string ML_MODEL_DIR =
 (ENV == "LOCAL")
@@ -10,6 +10,7 @@ namespace GeometryFeatures {
 	using FeatureMap = std::map<std::string, double>;
 
 	FeatureMap extract(const std::vector<Coord>& coords);
+	void extract(const std::vector<Coord>& coords, FeatureMap& F);	// reuses the nodes of F
 	std::string to_json(const FeatureMap& feats);
 
 }
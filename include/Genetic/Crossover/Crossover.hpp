@@ -17,10 +17,11 @@ protected:
     Random *random;
 public:
     Crossover();
-    ~Crossover();
+    virtual ~Crossover();
     void setContext(Random *random);
-    List* run(List* s1, List* s2);
-    virtual List* realRun(List* s1, List* s2) = 0;
+    // s: an empty list that receives the offspring, a new one if s is nullptr. returns s
+    List* run(List* s1, List* s2, List* s = nullptr);
+    virtual void realRun(List* s1, List* s2, List* s) = 0;
 };
 
 #endif //CETSP_CROSSOVER_HPP
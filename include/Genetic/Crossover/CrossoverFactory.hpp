@@ -12,6 +12,7 @@
 #include "EAX.hpp"
 #include "KSX.hpp"
 #include "GAX.hpp"
+#include "GPX.hpp"
 
 class CrossoverFactory {
 public:
@@ -27,12 +27,12 @@ private:
     void ABCycles();
     void ESets();                                   // simple : choose randomly one AB-cycle as E-set, block : an additional cycle
     void intermediateSol();                         // construct intermediate solution
-    List* completeSol();                            // construction feasible solution
+    void completeSol(List* offspring);              // construction feasible solution, the first sub-tour is built in offspring
     void connectTours(List* s1, List* s2);          // connect all tours to form only one tour
 public:
     EAX();
     ~EAX();
-    List* realRun(List* sa, List* sb);
+    void realRun(List* sa, List* sb, List* s);
 };
 
 
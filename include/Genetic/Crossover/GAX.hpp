@@ -13,7 +13,7 @@ class GAX : public Crossover {
 public:
     GAX();
     ~GAX();
-    List* realRun(List* s1, List* s2);
+    void realRun(List* s1, List* s2, List* s);
 };
 
 
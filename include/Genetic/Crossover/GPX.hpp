@@ -0,0 +1,30 @@
+/**
+ * GPX.hpp
+ * created on : Oct 17 2026
+ **/
+
+#ifndef CETSP_GPX_HPP
+#define CETSP_GPX_HPP
+
+#include "Utils/Random.hpp"
+#include "List.hpp"
+#include "Crossover.hpp"
+#include "LocalSearch/LKHLib.hpp"
+
+// generalized partition crossover 2 of LKH on the sequences, turning points chosen like KSX
+class GPX : public Crossover {
+private:
+    std::vector<std::vector<int>> A_link;
+    std::vector<std::vector<int>> B_link;
+    std::vector<std::vector<double>> positions;
+    std::vector<int> tour_a, tour_b, tour;          // buffers of realRun, kept between calls
+    std::vector<double> xs, ys;
+    std::vector<char> visited;
+    LKHLib lib;
+public:
+    GPX();
+    ~GPX();
+    void realRun(List* s1, List* s2, List* s);
+};
+
+#endif //CETSP_GPX_HPP
@@ -11,6 +11,7 @@
 #include "List.hpp"
 #include "LocalSearch/Neighbor.hpp"
 #include "Crossover.hpp"
+#include <array>
 
 class KSX : public Crossover {
 private:
@@ -18,11 +19,12 @@ private:
     std::vector<std::vector<int>> B_link;
     std::vector<std::vector<double>> positions;
     std::vector<bool> visited;
+    std::vector<std::array<int, 2>> cycle, completed_cycle;    // (parent, id) in tour order
     int k_step;
 public:
     KSX();
     ~KSX();
-    List* realRun(List* s1, List* s2);
+    void realRun(List* s1, List* s2, List* s);
 };
 
 #endif //CETSP_KSX_HPP
@@ -38,7 +38,10 @@ public:
 public:
     List();
     List(const List& s);
-    ~List();
+    ~List();                    // deletes the nodes of the list
+    void clear();               // deletes the nodes
+    void detach();              // forgets the nodes without deleting them, they were moved to another list
+    void reset();               // deletes the nodes and sets the fields of a new list, pre_vnd_coords keeps its storage
     List& operator=(List& s);
     void add(Node* node);
     void add(Node* node, Node* pos);
@@ -10,6 +10,7 @@
 #include "Utils/Geometry.hpp"
 #include <cmath>
 #include <algorithm>
+#include <cstddef>
 
 class Node {
 public:
@@ -22,6 +23,10 @@ public:
     Node& operator=(Node& n);
     static double distance(Node *n1, Node *n2);     // calculate the distance between two nodes
     static void swap(Node *n1, Node *n2);           // swap the info between two nodes
+    // nodes are carved from slabs and recycled through a free list of the thread that deletes them
+    static void* operator new(std::size_t size);
+    static void operator delete(void* p);
+    static long outstanding();                      // nodes created minus nodes deleted by this thread
 };
 
 #endif //CETSP_NODE_HPP
@@ -11,6 +11,7 @@
 #include "Utils/Random.hpp"
 #include "Utils/Data.hpp"
 #include "List.hpp"
+#include "TourSnapshot.hpp"
 #include "Geometry.hpp"
 #include "LocalSearch/LocalSearch.hpp"
 #include "Neighbor.hpp"
@@ -33,33 +34,52 @@ private:
     Kmeans kmeans;
     Centers centers;
     Neighbor neighbor;
-    List* best_solution;
+    TourSnapshot best_solution;     // shares the best member, publishing a new one is O(1)
     int population_size;
     std::string initialization;
     std::string selection;
     std::string crossover_type;
     double fit_beta;
     int dist_th;
+    bool prune;
+    bool adaptive_precision;
     std::unordered_map<List*, std::vector<double>> solution_map;
+    std::vector<TourSnapshot> spares;    // lists no other handle reads, reset for the next offspring
+    std::vector<double> offspring_distances;    // see minDistance
+    std::vector<std::pair<double, double>> vnd_points;    // adaptive precision: start of the tight re-solve
+    GeometryFeatures::FeatureMap features;    // ML filter: features of the offspring, the map keeps its keys
+    std::vector<TourSnapshot> retired;   // dropped by populationManagement, released at the end of nextPopulation
     List* initSolution();
     List* randomSolution();
     List* kmeansSolution();
     std::pair<List*, List*> chooseParent();
-    bool insertSolution(List* s);
+    bool insertSolution(const TourSnapshot& s);
+    bool insertSolution(const TourSnapshot& s, double min_dist, std::vector<double>& distances);    // with the result of minDistance
+    double minDistance(List* s, std::vector<double>& distances);   // distances: the population ones updated with s
     void updateDistances();
     void populationManagement();
     void randomSwap(List* s);
 
 
 public:
-    std::vector<List*> population;
+    std::vector<TourSnapshot> population;   // a member is not modified once inserted
     Population(Parameters* params);
     ~Population();
     void setContext(Centers& centers, Random* random, std::string timestamp);
     List* initPopulation();
     List* nextPopulation(int patience);
+    List* solveExact(List* s);   // exact turning points, for reporting the solutions of an approximate solver, returns
+                                 // the solved list, a copy of s if s is shared
     int current_iter = -1;
     int ml_reject_count = 0;
+    int prune_count = 0;         // offspring whose exact solve was skipped by the lower bound
+    int solve_count = 0;
+    double solve_time = 0;       // seconds in the exact solves that ran
+    double bound_time = 0;       // seconds in the pruning tests
+    int coarse_count = 0;        // exact solves at the coarse tolerance
+    int tight_count = 0;         // coarse solves re-solved tightly
+    double coarse_time = 0;
+    double tight_time = 0;
     Data* data = nullptr;    // ADD THIS LINE 
     SurvivalModel* ml_model;
 
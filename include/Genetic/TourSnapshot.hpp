@@ -0,0 +1,27 @@
+/**
+ * TourSnapshot.hpp
+ * created on : Oct 17 2026
+ **/
+
+#ifndef CETSP_TOURSNAPSHOT_HPP
+#define CETSP_TOURSNAPSHOT_HPP
+
+#include "List.hpp"
+#include <memory>
+
+// a reference-counted handle to a tour. copying a handle shares the list in O(1), the list is deleted with its
+// last handle. the tour of a shared list is immutable, edit() copies it first when another handle still reads it
+class TourSnapshot {
+private:
+    std::shared_ptr<List> list;
+public:
+    TourSnapshot() {}
+    explicit TourSnapshot(List* s);             // takes s
+    List* get() const { return list.get(); }
+    List* operator->() const { return list.get(); }
+    operator List*() const { return list.get(); }
+    bool shared() const { return list.use_count() > 1; }
+    List* edit();                               // the list, copied if it is shared
+};
+
+#endif //CETSP_TOURSNAPSHOT_HPP
@@ -0,0 +1,35 @@
+/**
+ * AngleDP.hpp
+ * created on : Oct 17 2026
+ **/
+
+#ifndef CETSP_ANGLEDP_HPP
+#define CETSP_ANGLEDP_HPP
+
+#include "Defs.hpp"
+#include <vector>
+
+// approximate turning points of a fixed sequence of disks. every disk gets K sampled points, its current point and
+// the points of its neighbors, which covers coincident disks, and a min-plus dynamic program picks one per disk
+// in O(n K^2). later rounds sample circles around the chosen points instead of the boundaries. the cycle is closed by fixing one disk at its current point, a second pass fixes the opposite disk.
+// the points are then refined one at a time by the reflection condition of Alhazen's problem.
+class AngleDP {
+private:
+    int n, k;                                       // k candidates per disk
+    std::vector<double> px, py;                     // candidates, k per disk
+    std::vector<double> cost, next_cost;            // best length to each candidate of the current disk
+    std::vector<int> from;                          // from[i * k + j]: candidate of disk i - 1 before candidate j of disk i
+    std::vector<double> dist;
+    // radius < 0: on the boundary, else on the circle of radius * r around the current point
+    void candidates(const double* cx, const double* cy, const double* r, const std::vector<double>& x, const std::vector<double>& y,
+                    double radius);
+    double pass(int start, std::vector<double>& x, std::vector<double>& y);   // the disk start keeps its point
+    double refine(const double* cx, const double* cy, const double* r, std::vector<double>& x, std::vector<double>& y);
+public:
+    AngleDP(int angles = SOLVER_DP_ANGLES);
+    ~AngleDP();
+    // x, y : start on input, turning points on output, returns the tour length
+    double solve(int n, const double* cx, const double* cy, const double* r, std::vector<double>& x, std::vector<double>& y);
+};
+
+#endif //CETSP_ANGLEDP_HPP
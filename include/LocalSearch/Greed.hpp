@@ -17,13 +17,14 @@ class Greed {
 private:
     Centers centers;
     std::string greed_type;
+    std::vector<double> old_x, old_y;    // points before the update, in tour order after the head
 public:
     Greed(std::string greed_type);
     ~Greed();
     void setContext(Centers &centers);
     void run(List *&s);
     double updatePosition(Node *node, double x0, double y0, double r);
-    std::vector<double> approxPosition(double x0, double y0, double r, Node *pre, Node *next);
+    void approxPosition(double x0, double y0, double r, Node *pre, Node *next, double& x, double& y);
     bool inLine(double x0, double y0, double r, Node* pre, Node* next);
 };
 
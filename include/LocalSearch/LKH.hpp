@@ -11,25 +11,83 @@
 #include "Genetic/Node.hpp"
 #include "Genetic/List.hpp"
 #include "ListAdapter.hpp"
+#include "LKHLib.hpp"
+#include "LKHPool.hpp"
+#include "LKHCache.hpp"
+#include "LKHController.hpp"
 #include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <atomic>
 
 class LKH {
 private:
+    std::string backend;                // FILE, LIB, POOL
+    int workers;                        // number of POOL workers
+    bool fix_edges;                     // keep the edge runs an offspring shares with both parents
+    std::string cost;                   // POINT: distance of the turning points, DISK: blended with the gap between the disks
+    double point_weight;                // weight of the turning points in the DISK cost
+    Centers centers;
+    LKHLib lib;
+    LKHPool pool;
+    LKHCache cache;
+    LKHController initial_control;      // effort on initial solutions
+    LKHController offspring_control;    // effort on offspring in the VND
     std::string lkh_exe;
-    std::string root_dir;
-    std::string params_file;
-    std::string problem_file;
-    std::string tour_file;
-    std::string result_file;
-    std::vector<std::vector<double>> positions;
-    void write(List* solution);         // write config of LKH and TSP problem
-    List* read();                       // read the solution
+    std::string root_dir;               // scratch area of this object only
+    std::atomic<int> task_count{0};
+    static std::atomic<int> instance_count;
+    // state of one call, so that concurrent calls share nothing mutable
+    struct Task {
+        std::string dir;
+        std::string params_file;
+        std::string problem_file;
+        std::string tour_file;
+        std::string result_file;
+        std::string pi_file;            // empty if the cache is disabled
+        std::string candidate_file;
+        std::vector<std::array<double, 2>> positions;
+        std::vector<int> tour;          // initial tour
+        std::vector<std::pair<int, int>> fixed;
+        LKHEffort effort;
+    };
+    // buffers of one call, one per thread so that concurrent calls share nothing mutable. they are reused, the C++
+    // side of a LIB call does not allocate once they are large enough, the LKH library still mallocs its own
+    struct Workspace {
+        ListAdapter la;
+        std::vector<bool> fix_next;             // see inheritedEdges
+        std::vector<int> links;                 // links[4 * id ..]: neighbors of id in both parents
+        std::vector<char> inherited;
+        std::vector<std::pair<int, int>> fixed;
+        std::vector<double> xs, ys;
+        std::vector<std::array<double, 2>> positions;
+        std::vector<int> tour;                  // by reduced id, the initial tour, then the one of LKH
+        std::vector<int> result;                // LIB backend: tour of LKH before the swap with tour
+        std::vector<Node*> nodes;               // by reduced id
+        LKHDisks disks;
+        LKHCandidates candidates;
+    };
+    Task makeTask();
+    void write(List* solution, Task& task);     // write config of LKH and TSP problem
+    bool read(Task& task, std::vector<int>& tour);     // read the solution, false if there is none
+    void writeCandidates(Task& task, LKHCandidates& candidates);   // PI_FILE and CANDIDATE_FILE from the cache
+    bool readCandidates(Task& task, LKHCandidates& candidates);    // PI_FILE and CANDIDATE_FILE written by LKH
+    // w.fix_next[id]: the edge from real id to its successor is in both parents and kept
+    void inheritedEdges(List* solution, List* parent1, List* parent2, Workspace& w);
+    // groups[i]: real ids merged into node i of the solution, fixed: edges LKH must keep. w.tour receives the
+    // new order, the solution is not changed
+    bool solveFile(List* solution, const Groups& groups, const std::vector<std::pair<int, int>>& fixed,
+                   const LKHEffort& effort, Workspace& w);
+    void solveMemory(List* solution, const Groups& groups, const std::vector<std::pair<int, int>>& fixed,
+                     const LKHEffort& effort, Workspace& w);
 public:
-    LKH();
+    LKH(std::string backend = LKH_BACKEND, int workers = LKH_WORKERS, double cache_tolerance = LKH_CACHE_TOLERANCE,
+        bool fix_edges = LKH_FIX_EDGES, bool adaptive = LKH_ADAPTIVE, std::string cost = LKH_COST,
+        double point_weight = LKH_POINT_WEIGHT);
     ~LKH();
-    void setContext(std::string timestamp, int random_value);
-    List* run(List* solution, bool adapted);
+    void setContext(std::string timestamp, int random_value, const Centers& centers = Centers());
+    // with parents, the edge runs common to both stay fixed if fix_edges is set
+    // the nodes of solution are relinked in the new order, solution is returned
+    List* run(List* solution, bool adapted, List* parent1 = nullptr, List* parent2 = nullptr);
 };
 #endif //CETSP_LKH_HPP
\ No newline at end of file
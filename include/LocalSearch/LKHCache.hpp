@@ -0,0 +1,45 @@
+/**
+ * LKHCache.hpp
+ * created on : Oct 17 2026
+ **/
+
+#ifndef CETSP_LKHCACHE_HPP
+#define CETSP_LKHCACHE_HPP
+
+#include "Defs.hpp"
+#include "LKHLib.hpp"
+#include "ListAdapter.hpp"
+#include <array>
+#include <vector>
+#include <mutex>
+
+// LKH penalties and candidate sets reused across calls, stored by target id
+class LKHCache {
+private:
+    struct Entry {
+        bool valid = false;
+        double x, y;                    // position of the target when computed
+        int pi;
+        std::vector<int> to;            // candidate targets
+        std::vector<int> alpha;
+    };
+    std::vector<Entry> entries;
+    double tolerance;                   // max drift relative to the bounding box diagonal, < 0 disables the cache
+    std::mutex mutex;
+    std::vector<int> node_of;           // lookup: node each cached target is merged into now
+    int hits = 0;
+    int misses = 0;
+    static double diagonal(const std::vector<std::array<double, 2>> &positions);
+public:
+    LKHCache(double tolerance = LKH_CACHE_TOLERANCE);
+    bool enabled() const { return tolerance >= 0; }
+    // groups: targets merged into each node, positions[i]: position of node i
+    // fills candidates for the problem and returns true if every target is cached and has not drifted
+    bool lookup(const Groups &groups, const std::vector<std::array<double, 2>> &positions, LKHCandidates &candidates);
+    // replaces the cache with the candidates computed for the problem
+    void store(const Groups &groups, const std::vector<std::array<double, 2>> &positions, const LKHCandidates &candidates);
+    int getHits() const { return hits; }
+    int getMisses() const { return misses; }
+};
+
+#endif //CETSP_LKHCACHE_HPP
@@ -0,0 +1,38 @@
+/**
+ * LKHController.hpp
+ * created on : Oct 17 2026
+ **/
+
+#ifndef CETSP_LKHCONTROLLER_HPP
+#define CETSP_LKHCONTROLLER_HPP
+
+#include "Defs.hpp"
+#include "LKHLib.hpp"
+#include <vector>
+#include <mutex>
+
+// picks MOVE_TYPE, RUNS and MAX_TRIALS of each LKH call from the tour length recent calls gained per second
+class LKHController {
+private:
+    struct Level {
+        LKHEffort effort;
+        double rate = -1;               // smoothed gain per second, < 0 if never tried
+    };
+    std::vector<Level> levels;          // increasing effort
+    bool adaptive;
+    int level = -1;                     // current level, chosen from the instance size on the first call
+    int calls = 0;                      // calls recorded since the last decision
+    std::mutex mutex;
+public:
+    struct Decision {
+        int level;
+        LKHEffort effort;
+    };
+    LKHController(bool adaptive = LKH_ADAPTIVE);
+    // size: nodes of the problem, change: fraction of its edges that are not in both parents
+    Decision choose(int size, double change);
+    // gain: tour length removed by the call
+    void record(const Decision& decision, double gain, double seconds);
+};
+
+#endif //CETSP_LKHCONTROLLER_HPP
@@ -0,0 +1,54 @@
+/**
+ * LKHLib.hpp
+ * created on : Oct 17 2026
+ **/
+
+#ifndef CETSP_LKHLIB_HPP
+#define CETSP_LKHLIB_HPP
+
+#include <vector>
+#include <mutex>
+
+// penalties and candidate sets of a problem, the in-memory PI_FILE and CANDIDATE_FILE
+struct LKHCandidates {
+    bool given = false;                 // use them instead of the ascent, otherwise filled by the solve
+    int width = 8;                      // candidates stored per node
+    std::vector<int> pi;                // pi[i] : penalty of node i
+    std::vector<int> to;                // to[i * width + k] : k-th candidate of node i, or -1
+    std::vector<int> alpha;             // alpha[i * width + k] : its alpha-value
+};
+
+// search effort of one LKH call
+struct LKHEffort {
+    int move_type = 5;                  // MOVE_TYPE
+    int runs = 1;                       // RUNS
+    int max_trials = 10;                // MAX_TRIALS
+};
+
+// disks of the nodes, LKH then blends the distance of the points with the gap between the disks
+struct LKHDisks {
+    std::vector<double> x, y, r;        // center and radius of the disk of node i
+    double point_weight = 1;            // weight of the points, 1 - point_weight for the disks
+};
+
+// in-process facade of the LKH library, no files and no child process
+class LKHLib {
+private:
+    static std::mutex lkh_mutex;        // LKH keeps its state in globals
+public:
+    unsigned seed = 1;
+    // xs, ys: coordinates of node i, tour: initial tour of node ids, fixed: tour edges LKH must keep
+    // returns the improved tour
+    std::vector<int> solve(const std::vector<double> &xs, const std::vector<double> &ys, const std::vector<int> &tour,
+                           const LKHEffort &effort = LKHEffort(), LKHCandidates *candidates = nullptr,
+                           const std::vector<std::pair<int, int>> &fixed = {}, const LKHDisks *disks = nullptr) const;
+    // same, the improved tour goes to result, which keeps its storage and must not be tour
+    void solve(const std::vector<double> &xs, const std::vector<double> &ys, const std::vector<int> &tour,
+               std::vector<int> &result, const LKHEffort &effort = LKHEffort(), LKHCandidates *candidates = nullptr,
+               const std::vector<std::pair<int, int>> &fixed = {}, const LKHDisks *disks = nullptr) const;
+    // GPX2 offspring of two tours of node ids, made of their edges only, offspring keeps its storage
+    void gpx(const std::vector<double> &xs, const std::vector<double> &ys, const std::vector<int> &tour_a,
+             const std::vector<int> &tour_b, std::vector<int> &offspring) const;
+};
+
+#endif //CETSP_LKHLIB_HPP
@@ -0,0 +1,45 @@
+/**
+ * LKHPool.hpp
+ * created on : Oct 17 2026
+ **/
+
+#ifndef CETSP_LKHPOOL_HPP
+#define CETSP_LKHPOOL_HPP
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include "LKHLib.hpp"
+
+// long-lived LKH worker processes fed over stdin/stdout pipes
+class LKHPool {
+private:
+    struct Worker {
+        FILE* to = nullptr;             // worker stdin
+        FILE* from = nullptr;           // worker stdout
+        long long pid = 0;              // pid on POSIX, process handle on Windows
+        bool busy = false;
+    };
+    std::string worker_exe;
+    std::vector<Worker> workers;
+    std::mutex mutex;
+    std::condition_variable idle;
+    bool spawn(Worker& w);
+    void stop(Worker& w);
+public:
+    unsigned seed = 1;
+    LKHPool() = default;
+    LKHPool(const LKHPool&) = delete;
+    LKHPool& operator=(const LKHPool&) = delete;
+    ~LKHPool();
+    void start(std::string worker_exe, int size);
+    int size() const { return workers.size(); }
+    // same contract as LKHLib::solve, blocks until a worker is idle
+    std::vector<int> solve(const std::vector<double> &xs, const std::vector<double> &ys, const std::vector<int> &tour,
+                           const LKHEffort &effort = LKHEffort(), LKHCandidates *candidates = nullptr,
+                           const std::vector<std::pair<int, int>> &fixed = {}, const LKHDisks *disks = nullptr);
+};
+
+#endif //CETSP_LKHPOOL_HPP
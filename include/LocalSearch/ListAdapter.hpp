@@ -11,15 +11,28 @@
 #include "Genetic/List.hpp"
 #include <vector>
 
+// real ids merged into each reduced node, in tour order: ids[start[i]] .. ids[start[i + 1] - 1] for node i
+struct Groups {
+    std::vector<int> start;
+    std::vector<int> ids;
+    int size() const { return (int) start.size() - 1; }
+    int first(int i) const { return ids[start[i]]; }
+    int last(int i) const { return ids[start[i + 1] - 1]; }
+};
+
+// merges consecutive nodes at the same position, the arrays are reused so that no call allocates once they are large enough
 class ListAdapter {
 private:
-    std::vector<std::vector<int>> nodes;
-    std::vector<std::vector<double>> positions;
+    Groups groups;
+    std::vector<double> xs, ys;                 // position of each reduced node
+    std::vector<Node*> merged;                  // merged[k]: unlinked node of groups.ids[k], nullptr for the first of a group
 public:
     ListAdapter();
     ~ListAdapter();
     List* real2Reduced(List* real_list);        // real list to reduced list
     List* reduced2Real(List* reduced_list);     // reduced list to real list
+    void identity(int size);                    // groups of a list that is not reduced
+    const Groups& getGroups() const { return groups; }
 };
 
 #endif //CETSP_LISTADAPTER_HPP
@@ -14,6 +14,7 @@
 #include "Geometry.hpp"
 #include "Neighbor.hpp"
 #include "LocalSearch/LKH.hpp"
+#include "LocalSearch/SequenceOpt.hpp"
 #include "Solver.hpp"
 #include "Greed.hpp"
 #include <chrono>
@@ -23,9 +24,12 @@ private:
     std::vector<double> costs;
     Random *random;
     Centers centers;
-    Neighbors neighbors;
+    const Neighbors* neighbors = nullptr;      // of the neighbor object, read by jointOpt
+    std::vector<Node*> nodes;                  // tour order of the current move search
     Neighbor* neighbor;
     LKH lkh;
+    SequenceOpt sequence;
+    std::string seq_opt;
     Greed greed;
     Solver solver;
     std::string improvement;
@@ -41,7 +45,13 @@ public:
     ~LocalSearch();
     void setContext(Random *random, Centers &centers, Neighbor* neighbor, std::string timestamp);
     List *initSolOpt(List *s);
-    List *VND(List *s);
+    // exact = false stops before the exact solve of the turning points, see solve and lowerBound. s is changed in
+    // place and returned
+    List *VND(List *s, List *parent1 = nullptr, List *parent2 = nullptr, bool exact = true);
+    double solve(List *s, double tolerance = SOLVER_TOLERANCE);     // returns the bound on the length above the optimum
+    void solveBatch(const std::vector<List*>& solutions);
+    void solveExact(List *s);
+    double lowerBound(List *s, double cutoff);
 };
 
 #endif // CETSP_LOCALSEARCH_HPP
\ No newline at end of file
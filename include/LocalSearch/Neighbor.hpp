@@ -19,6 +19,9 @@ private:
     std::vector<std::vector<double>> centroids;     // centroids of historical positions
     std::vector<std::vector<double>> distances;     // distances between centroids
     Neighbors neighbors;                            // neighbors
+    std::vector<std::vector<int>> lists;            // lists[i]: nearest neighbors of i, nearest first
+    std::vector<int> order;                         // buffers of updateNeighbors, kept between calls
+    std::vector<double> sorted;
 public:
     Neighbor(int neighbor_size);
     ~Neighbor();
@@ -26,7 +29,8 @@ public:
     void updateCentroids(List* s);
     void updateNeighbors();
     std::vector<std::vector<double>> getCentroids();
-    Neighbors getNeighbors();
+    const Neighbors& getNeighbors() const { return neighbors; }
+    const std::vector<std::vector<int>>& getNeighborLists() const { return lists; }
 };
 
 
@@ -0,0 +1,39 @@
+/**
+ * RubberBand.hpp
+ * created on : Oct 17 2026
+ **/
+
+#ifndef CETSP_RUBBERBAND_HPP
+#define CETSP_RUBBERBAND_HPP
+
+#include "Defs.hpp"
+#include <cmath>
+#include <vector>
+
+// primal-dual hybrid gradient for the turning points of a fixed sequence of disks, warm started from the current points.
+// the dual variables are unit vectors u[i] on the edges, and any of them gives the lower bound
+//     sum c[i] . g[i] - r[i] |g[i]|  with g[i] = u[i] - u[i - 1],
+// so every check certifies the gap of the best points found so far. an iteration is one O(n) sweep.
+class RubberBand {
+private:
+    int n;
+    std::vector<double> ux, uy;                     // dual, one per edge
+    std::vector<double> px, py;                     // previous points
+    std::vector<double> bx, by;                     // best points
+    double length(const std::vector<double>& x, const std::vector<double>& y) const;
+    double bound(const double* cx, const double* cy, const double* r) const;
+public:
+    struct Result {
+        double value;                               // length of the returned points
+        double gap;                                 // certified relative gap
+        int iterations;
+    };
+    RubberBand();
+    ~RubberBand();
+    // x, y : start on input, best points on output, stops once the relative gap is below gap,
+    // or once the bound reaches cutoff or the length falls below it
+    Result solve(int n, const double* cx, const double* cy, const double* r, std::vector<double>& x, std::vector<double>& y,
+                 double gap, int max_iterations = SOLVER_BAND_ITERATIONS, double cutoff = INFINITY);
+};
+
+#endif //CETSP_RUBBERBAND_HPP
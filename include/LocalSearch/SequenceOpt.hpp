@@ -0,0 +1,51 @@
+/**
+ * SequenceOpt.hpp
+ * created on : Oct 17 2026
+ **/
+
+#ifndef CETSP_SEQUENCEOPT_HPP
+#define CETSP_SEQUENCEOPT_HPP
+
+#include "Defs.hpp"
+#include "Genetic/List.hpp"
+#include "ListAdapter.hpp"
+#include "TwoLevelList.hpp"
+#include <vector>
+#include <deque>
+
+// 2-opt and Or-opt on the reduced tour, restricted to the neighbor lists and driven by don't-look bits
+class SequenceOpt {
+private:
+    ListAdapter la;
+    int size;
+    std::vector<Node*> nodes;                   // nodes[id]: reduced node
+    std::vector<int> order;                     // order[i]: id at position i
+    std::vector<int> pos;                       // pos[id]: position of id
+    std::vector<int> cand_start, cand;          // candidates of id: cand[cand_start[id]] .. cand[cand_start[id + 1] - 1]
+    std::vector<int> reduced;                   // reduced[real id]: reduced id
+    std::vector<int> stamp;
+    std::vector<char> active;                   // don't-look bits, 1 if queued
+    std::deque<int> queue;
+    // from SEQ_OPT_TWO_LEVEL nodes the tour is a two-level list instead of order and pos
+    int two_level_size;
+    bool two_level = false;
+    TwoLevelList list;
+    double dist(int a, int b) { return Node::distance(nodes[a], nodes[b]); }
+    int succ(int a) { return two_level ? list.next(a) : order[pos[a] + 1 == size ? 0 : pos[a] + 1]; }
+    int pred(int a) { return two_level ? list.prev(a) : order[pos[a] == 0 ? size - 1 : pos[a] - 1]; }
+    void push(int a);
+    void reverse(int i, int len);               // reverse the len positions from i
+    void reversePath(int a, int b);             // reverse the path a .. b, or its complement if shorter
+    // replace (t1, t2) and (t3, t4) by (t1, t3) and (t2, t4), t2 and t4 follow t1 and t3 in the same direction
+    void move(int t1, int t2, int t3, int t4);
+    void buildCandidates(const Groups& groups, const std::vector<std::vector<int>>& lists);
+    double twoOpt(int t1);
+    double orOpt(int t1);
+public:
+    SequenceOpt(int two_level_size = SEQ_OPT_TWO_LEVEL);
+    ~SequenceOpt();
+    List* run(List* solution, const std::vector<std::vector<int>>& lists);
+    static double newEdges(List* offspring, List* parent1, List* parent2);     // fraction of edges in neither parent
+};
+
+#endif //CETSP_SEQUENCEOPT_HPP
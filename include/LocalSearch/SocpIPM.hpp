@@ -0,0 +1,43 @@
+/**
+ * SocpIPM.hpp
+ * created on : Oct 17 2026
+ **/
+
+#ifndef CETSP_SOCPIPM_HPP
+#define CETSP_SOCPIPM_HPP
+
+#include "Defs.hpp"
+#include <vector>
+
+// barrier method for the turning points of a fixed sequence of disks:
+//     min sum |p[i] - p[i + 1]|  s.t.  |p[i] - c[i]| <= r[i]
+// the edge lengths are minimized out of the barrier, so each Newton system only couples consecutive points.
+// it is block cyclic tridiagonal with 2x2 blocks and is solved in O(n) by block elimination with a border.
+class SocpIPM {
+private:
+    struct Mat2 { double a, b, c, d; };             // [a b; c d]
+    int n;
+    double mu;
+    const double *cx, *cy, *r;
+    std::vector<char> fixed;                        // disks of radius 0
+    std::vector<double> gx, gy;                     // gradient
+    std::vector<double> sx, sy;                     // right-hand side, then Newton step
+    std::vector<Mat2> diag, edge;                   // edge[i]: block between i and i + 1
+    std::vector<Mat2> inv, z, v;                    // elimination
+    std::vector<double> ux, uy;
+    std::vector<double> tx, ty;                     // trial point
+    double barrier(const std::vector<double>& x, const std::vector<double>& y);        // infinite outside the disks
+    double newtonStep(const std::vector<double>& x, const std::vector<double>& y);     // returns the squared decrement
+    void solveSystem();                             // solves H s = sx, sy in place
+public:
+    SocpIPM();
+    ~SocpIPM();
+    int iterations = 0;                             // Newton steps of the last solve
+    double gap = 0;                                 // bound on the length above the optimum of the last solve
+    // x, y : start on input, turning points on output, returns the tour length.
+    // the gap is at most tolerance times the length of the start
+    double solve(int n, const double* cx, const double* cy, const double* r, std::vector<double>& x, std::vector<double>& y,
+                 double tolerance = SOLVER_TOLERANCE);
+};
+
+#endif //CETSP_SOCPIPM_HPP
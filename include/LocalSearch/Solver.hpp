@@ -9,17 +9,92 @@
 
 #include "Defs.hpp"
 #include "Genetic/List.hpp"
+#include "SocpIPM.hpp"
+#include "RubberBand.hpp"
+#include "AngleDP.hpp"
+#ifdef CETSP_USE_GUROBI
 #include "gurobi_c++.h"
+#endif
 #include <chrono>
+#include <memory>
+#include <thread>
 
 class Solver {
 private:
     std::vector<std::vector<double>> centers;    // (x, y, r)
+    std::string backend;                         // GUROBI, NATIVE, BAND, DP
+    double gap;                                  // BAND: relative gap to reach
+    SocpIPM ipm;
+    RubberBand band;
+    AngleDP dp;
+    std::vector<double> cx, cy, r, x, y;
+    double tolerance = SOLVER_TOLERANCE;         // of the current solve
+    double excess = 0;                           // bound on the length above the optimum of the last optimize
+    double build_time = 0, optimize_time = 0;    // GUROBI: seconds spent setting the model up and optimizing it
+#ifdef CETSP_USE_GUROBI
+    GRBEnv* env = nullptr;
+    GRBModel* model = nullptr;                   // kept for the last size, only the right-hand sides change
+    int model_size = 0;
+    GRBVar *dist = nullptr, *dx = nullptr, *dy = nullptr, *s = nullptr, *t = nullptr, *vx = nullptr, *vy = nullptr;
+    std::vector<GRBConstr> center_x, center_y;   // s[i] + x[i] == cx[i], t[i] + y[i] == cy[i]
+    std::vector<GRBQConstr> disks;               // s[i]^2 + t[i]^2 <= r[i]^2
+    void buildModel(int n);
+#endif
+    // incremental mode: the windows of nodes whose neighbors changed since the closest cached full solve are
+    // re-solved with the points around them fixed
+    struct Exact {
+        std::vector<int> pre, next;              // neighbors by id
+        std::vector<double> x, y;                // points by id
+    };
+    struct Window {
+        SocpIPM ipm;
+        std::vector<double> cx, cy, r, x, y;
+    };
+    bool incremental;
+    std::vector<Exact> exacts;                   // ring of the last full solves
+    int exact_next = 0;
+    std::vector<int> ids;                        // ids in tour order, filled by load
+    std::vector<char> marked;
+    std::vector<std::pair<int, int>> windows;    // first position and length
+    std::vector<Window> workers;                 // one per thread
+    void remember();
+    bool solveWindows(List* solution);           // false if most of the tour changed
+    void solveWindow(Window& w, int first, int len);
+    void runWindows();                           // solves all windows on the threads
+    // split mode: with several threads, the tour is cut into one window per thread and swept until it stalls.
+    // the sweeps have no coupling step and may stall away from the optimum, the gap is measured by certify
+    int threads;                                 // 0: one for NATIVE and BAND, Gurobi's own choice for GUROBI
+    double solveSplit(int n);
+    double length() const;                       // of x, y
+    std::vector<double> ux, uy;                  // directions of the edges of x, y
+    double certify(int n);                       // length of x, y, sets excess from a dual point built from them
+    // batch mode: one solver per thread, each with its share of the threads for its splits
+    std::vector<std::unique_ptr<Solver>> batch;
+    // active-set mode: disks crossed by the straight path between their constrained neighbors are dropped,
+    // the violated ones are added back until the path crosses all of them
+    bool active_set;
+    std::vector<char> active;
+    std::vector<int> order;                      // positions of the constrained disks
+    std::vector<double> acx, acy, ar, ax, ay;
+    double optimizeActive(int n);
+    int load(List* solution);                    // fills ids, cx, cy, r, x, y in tour order
+    void store(List* solution, double value);
+    // the turning points of a sequence with the backend, returns the length or NAN on failure
+    double optimize(int n, const double* cx, const double* cy, const double* r, std::vector<double>& x, std::vector<double>& y);
+    double optimizeGurobi(int n, const double* cx, const double* cy, const double* r, std::vector<double>& x, std::vector<double>& y);
 public:
-    Solver();
+    Solver(std::string backend = SOLVER_BACKEND, double gap = SOLVER_BAND_GAP, bool incremental = SOLVER_INCREMENTAL,
+           bool active_set = SOLVER_ACTIVE_SET, int threads = SOLVER_THREADS);
     ~Solver();
     void setContext(Centers &centers);
-    void solve(List* solution);
+    // tolerance: NATIVE, BAND, GUROBI: relative gap of the full and active-set solves, the windows and the
+    // splits keep SOLVER_TOLERANCE. returns the bound on the length above the optimum, 0 for DP
+    double solve(List* solution, double tolerance = SOLVER_TOLERANCE);
+    // the tours are solved in parallel, the threads of the solver are shared between them
+    void solveBatch(const std::vector<List*>& solutions, double tolerance = SOLVER_TOLERANCE);
+    void solveExact(List* solution);             // NATIVE, or GUROBI with that backend, for the reported solutions
+    // lower bound on the optimal length of the sequence, the work stops once it is known on which side of cutoff it is
+    double lowerBound(List* solution, double cutoff = INFINITY);
 };
 
 #endif // CETSP_SOLVER_HPP
\ No newline at end of file
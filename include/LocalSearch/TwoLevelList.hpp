@@ -0,0 +1,44 @@
+/**
+ * TwoLevelList.hpp
+ * created on : Oct 17 2026
+ **/
+
+#ifndef CETSP_TWOLEVELLIST_HPP
+#define CETSP_TWOLEVELLIST_HPP
+
+#include <vector>
+
+// a tour of ids 0 .. n - 1 cut into segments of about sqrt(n) ids, each with a reversal bit and its rank in the
+// tour. next, prev and between are O(1), reverse splits the segments at both ends of the path and reverses the
+// order of the ones in between, or of the others if they are fewer, in O(sqrt n). the segments are rebuilt once
+// the splits have doubled their number. reversing the others leaves the same cycle read backwards, so after
+// reverse next and prev may have swapped for every id: callers must take the orientation from next, not keep it
+class TwoLevelList {
+private:
+    struct Segment {
+        std::vector<int> ids;
+        bool reversed = false;
+        int rank = 0;                           // position of the segment in the tour
+    };
+    int n = 0, group = 1, limit = 1;            // ids per segment after a rebuild, segments before the next one
+    std::vector<Segment> segments;
+    std::vector<int> order;                     // order[rank]: segment
+    std::vector<int> seg, index;                // seg[id], index[id]: segment of id and its index in the ids
+    std::vector<int> buffer;
+    int offset(int id) const;                   // position of id in its segment, in tour direction
+    int at(int s, int k) const;                 // id at position k of segment s, in tour direction
+    bool before(int a, int b) const;            // a comes first from the start of order[0]
+    void split(int id);                         // id becomes the first of its segment
+    void rebuild(const std::vector<int>& tour);
+public:
+    TwoLevelList();
+    ~TwoLevelList();
+    void init(const std::vector<int>& tour);
+    int next(int id) const;
+    int prev(int id) const;
+    bool between(int a, int b, int c) const;    // b is on the path a .. c
+    void reverse(int a, int b);                 // the path a .. b, or the rest of the tour
+    void tour(std::vector<int>& out) const;     // ids in tour order
+};
+
+#endif //CETSP_TWOLEVELLIST_HPP
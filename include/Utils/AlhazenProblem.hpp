@@ -9,6 +9,7 @@
 
 #include "Vector3d.hpp"
 #include <cmath>
+#include <array>
 
 class AlhazenProblem {
 private:
@@ -22,7 +23,7 @@ private:
 public:
     AlhazenProblem(double x1, double y1, double x2, double y2, double x0, double y0, double R);
     ~AlhazenProblem();
-    std::vector<double> solve();
+    std::array<double, 3> solve();
 };
 
 
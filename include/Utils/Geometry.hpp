@@ -21,41 +21,54 @@ public:
     }
 
     static std::vector<std::vector<double>> solveLineIntersectSphere(double x1, double y1, double x2, double y2, double x0, double y0, double R) {
-        std::vector<Vector3d> points;
-        Vector3d A(x1, y1, 0);
-        Vector3d B(x2, y2, 0);
-        Vector3d O(x0, y0, 0);
-        Vector3d V = B - A;
+        double x[2], y[2];
+        int count = lineIntersectSphere(x1, y1, x2, y2, x0, y0, R, x, y);
+        std::vector<std::vector<double>> intersections;
+        for (int i = 0; i < count; ++i) {
+            intersections.emplace_back(std::vector<double> {x[i], y[i]});
+        }
+        return intersections;
+    }
+
+    // same as solveLineIntersectSphere without allocating, the intersections go to x, y, returns their number
+    static int lineIntersectSphere(double x1, double y1, double x2, double y2, double x0, double y0, double R, double* x, double* y) {
+        double vx = x2 - x1, vy = y2 - y1;
         // coefficient
-        double a = (V.x * V.x) + (V.y * V.y) + (V.z * V.z);
-        double b = 2 * V.x * (A.x - O.x) + 2 * V.y * (A.y - O.y) + 2 * V.z * (A.z - O.z);
-        double c = ((A.x - O.x)*(A.x - O.x) + (A.y - O.y) * (A.y - O.y) + (A.z - O.z) * (A.z - O.z)) - R * R;
+        double a = (vx * vx) + (vy * vy);
+        double b = 2 * vx * (x1 - x0) + 2 * vy * (y1 - y0);
+        double c = ((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0)) - R * R;
 
-        std::vector<double> t;
-        solveQuadratics(a, b, c, t);
-        for (double it : t)  {
-            if (it >= 0 && it <= 1) {
-                points.push_back(A + V.Scalar(it));
+        double t[2];
+        int roots = solveQuadratics(a, b, c, t);
+        int count = 0;
+        for (int i = 0; i < roots; ++i) {
+            if (t[i] >= 0 && t[i] <= 1) {
+                x[count] = x1 + t[i] * vx;
+                y[count] = y1 + t[i] * vy;
+                ++count;
             }
         }
-        std::vector<std::vector<double>> intersections;
-        for (Vector3d it : points) {
-            intersections.emplace_back(std::vector<double> {it.x, it.y});
-        }
-        return intersections;
+        return count;
     }
 
     static void solveQuadratics(double a, double b, double c, std::vector<double>& t) {
+        double roots[2];
+        int count = solveQuadratics(a, b, c, roots);
+        t.insert(t.end(), roots, roots + count);
+    }
+
+    static int solveQuadratics(double a, double b, double c, double* t) {
         double delta = b * b - 4 * a * c;
         if (delta < 0) {
-            return;
+            return 0;
         }
         if (abs(delta) < EPSILON) {
-            t.push_back(-b / (2 * a));
-        } else {
-            t.push_back((-b + std::sqrt(delta)) / (2 * a));
-            t.push_back((-b - std::sqrt(delta)) / (2 * a));
+            t[0] = -b / (2 * a);
+            return 1;
         }
+        t[0] = (-b + std::sqrt(delta)) / (2 * a);
+        t[1] = (-b - std::sqrt(delta)) / (2 * a);
+        return 2;
     }
 
     static double EucDistance(double x1, double y1, double x2, double y2) {
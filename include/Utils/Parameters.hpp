@@ -25,6 +25,19 @@ public:
     std::string improvement;
     std::string greed;
     std::string distance;
+    std::string lkh_backend;
+    int lkh_workers;
+    double lkh_cache_tol;
+    bool lkh_fix;
+    bool lkh_adaptive;
+    std::string lkh_cost;
+    double lkh_point_weight;
+    std::string seq_opt;
+    std::string solver;
+    double solver_gap;
+    bool solver_incremental;
+    bool solver_active;
+    int solver_threads;
     int instance_index;
     int population_size;
     int iteration;
@@ -32,6 +45,8 @@ public:
     double max_time;
     double fit_beta;
     int dist_th;
+    bool prune;
+    bool adaptive_precision;
     int neighbor_size;
     Parameters(int argc, char **argv);
     Parameters() = default;
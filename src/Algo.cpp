@@ -34,7 +34,7 @@ void Algo::run() {
     int best_iter = 0;
     int patience = 0;
     bool improved = false;
-    std::chrono::duration<double> best_running_time;
+    std::chrono::duration<double> best_running_time(0);
     // init population
     List* best_solution = population.initPopulation();
     double best_solution_value = best_solution->getValue();
@@ -143,6 +143,12 @@ void Algo::run() {
 
     auto end_run = std::chrono::high_resolution_clock::now();
 
+    // the DP solver is approximate, the reported solution gets the exact turning points
+    if (params->solver == "DP") {
+        best_solution = population.solveExact(best_solution);
+        if (LOG) data.write(best_solution, best_iter, std::to_string(best_running_time.count()));
+    }
+
     if (!LOG)  data.write(best_solution, best_iter, std::to_string(best_running_time.count()));
 
     std::cout << std::endl
@@ -156,6 +162,21 @@ void Algo::run() {
     std::cout << "[ML] Total offspring rejected before VND: "
         << population.ml_reject_count << std::endl;
 
+    // mean time of the exact solves that ran, the pruning saving is estimated with it
+    double mean_solve = population.solve_count > 0 ? population.solve_time / population.solve_count : 0;
+    std::cout << "[PRUNE] exact solves skipped: " << population.prune_count
+        << " run: " << population.solve_count
+        << " bound_time: " << population.bound_time
+        << " saved_time: " << population.prune_count * mean_solve - population.bound_time << std::endl;
+
+    // the re-solves start from the coarse points and are cheaper than tight solves from scratch, the saving is
+    // the difference of mean_time with a run with --adaptive_precision 0
+    std::cout << "[PRECISION] coarse solves: " << population.coarse_count
+        << " re-solved tightly: " << population.tight_count
+        << " coarse_time: " << population.coarse_time
+        << " tight_time: " << population.tight_time
+        << " mean_time: " << mean_solve << std::endl;
+
 }
 void Algo::run_ml_training() {
     std::cout << "\n[ML] Starting machine learning training phase..." << std::endl;
@@ -9,6 +9,13 @@ namespace GeometryFeatures {
     FeatureMap extract(const std::vector<Coord>& coords)
     {
         FeatureMap F;
+        extract(coords, F);
+        return F;
+    }
+
+    void extract(const std::vector<Coord>& coords, FeatureMap& F)
+    {
+        // the features are read from coords directly and written over the keys F already has
 
         int n = coords.size();
         if (n < 2) {
@@ -22,34 +29,25 @@ namespace GeometryFeatures {
             F["centroid_y"] = 0;
             F["centroid_dist_sum"] = 0;
             F["angle_variance"] = 0;
-            return F;
-        }
-
-        std::vector<double> xs(n), ys(n);
-        for (int i = 0; i < n; i++) {
-            xs[i] = coords[i].first;
-            ys[i] = coords[i].second;
+            return;
         }
 
         // ------------------------
         // EDGE LENGTHS
         // ------------------------
-        std::vector<double> edges;
-        edges.reserve(n);
-
-        for (int i = 0; i < n - 1; i++) {
-            double dx = xs[i + 1] - xs[i];
-            double dy = ys[i + 1] - ys[i];
-            edges.push_back(std::sqrt(dx * dx + dy * dy));
-        }
+        auto edge = [&](int i) {
+            double dx = coords[i + 1].first - coords[i].first;
+            double dy = coords[i + 1].second - coords[i].second;
+            return std::sqrt(dx * dx + dy * dy);
+        };
 
         double sum_e = 0;
-        for (double e : edges) sum_e += e;
-        double avg_e = sum_e / edges.size();
+        for (int i = 0; i < n - 1; i++) sum_e += edge(i);
+        double avg_e = sum_e / (n - 1);
 
         double var_sum = 0;
-        for (double e : edges) var_sum += (e - avg_e) * (e - avg_e);
-        double var_e = var_sum / edges.size();
+        for (int i = 0; i < n - 1; i++) var_sum += (edge(i) - avg_e) * (edge(i) - avg_e);
+        double var_e = var_sum / (n - 1);
 
         F["avg_edge_length"] = avg_e;
         F["var_edge_length"] = var_e;
@@ -57,10 +55,14 @@ namespace GeometryFeatures {
         // ------------------------
         // BOUNDING BOX
         // ------------------------
-        double min_x = *std::min_element(xs.begin(), xs.end());
-        double max_x = *std::max_element(xs.begin(), xs.end());
-        double min_y = *std::min_element(ys.begin(), ys.end());
-        double max_y = *std::max_element(ys.begin(), ys.end());
+        double min_x = coords[0].first, max_x = min_x;
+        double min_y = coords[0].second, max_y = min_y;
+        for (int i = 1; i < n; i++) {
+            min_x = std::min(min_x, coords[i].first);
+            max_x = std::max(max_x, coords[i].first);
+            min_y = std::min(min_y, coords[i].second);
+            max_y = std::max(max_y, coords[i].second);
+        }
 
         double width = max_x - min_x;
         double height = max_y - min_y;
@@ -74,8 +76,8 @@ namespace GeometryFeatures {
         // ------------------------
         double cx = 0, cy = 0;
         for (int i = 0; i < n; i++) {
-            cx += xs[i];
-            cy += ys[i];
+            cx += coords[i].first;
+            cy += coords[i].second;
         }
         cx /= n;
         cy /= n;
@@ -88,8 +90,8 @@ namespace GeometryFeatures {
         // ------------------------
         double dist_sum = 0;
         for (int i = 0; i < n; i++) {
-            double dx = xs[i] - cx;
-            double dy = ys[i] - cy;
+            double dx = coords[i].first - cx;
+            double dy = coords[i].second - cy;
             dist_sum += std::sqrt(dx * dx + dy * dy);
         }
         F["centroid_dist_sum"] = dist_sum;
@@ -97,40 +99,48 @@ namespace GeometryFeatures {
         // ------------------------
         // ANGLE VARIANCE (smoothness)
         // ------------------------
-        std::vector<double> angles;
-        for (int i = 1; i < n - 1; i++) {
-            double ax = xs[i - 1] - xs[i];
-            double ay = ys[i - 1] - ys[i];
-            double bx = xs[i + 1] - xs[i];
-            double by = ys[i + 1] - ys[i];
+        // the angle at i, negative where an edge is too short to give one
+        auto angle = [&](int i) {
+            double ax = coords[i - 1].first - coords[i].first;
+            double ay = coords[i - 1].second - coords[i].second;
+            double bx = coords[i + 1].first - coords[i].first;
+            double by = coords[i + 1].second - coords[i].second;
 
             double dot = ax * bx + ay * by;
             double normA = std::sqrt(ax * ax + ay * ay);
             double normB = std::sqrt(bx * bx + by * by);
 
-            if (normA < 1e-9 || normB < 1e-9) continue;
+            if (normA < 1e-9 || normB < 1e-9) return -1.0;
 
             double cosang = dot / (normA * normB);
             if (cosang > 1) cosang = 1;
             if (cosang < -1) cosang = -1;
 
-            angles.push_back(std::acos(cosang));
+            return std::acos(cosang);
+        };
+
+        int count = 0;
+        double avg_ang = 0;
+        for (int i = 1; i < n - 1; i++) {
+            double a = angle(i);
+            if (a < 0) continue;
+            avg_ang += a;
+            count++;
         }
 
         double var_ang = 0;
-        if (!angles.empty()) {
-            double avg_ang = 0;
-            for (double a : angles) avg_ang += a;
-            avg_ang /= angles.size();
+        if (count > 0) {
+            avg_ang /= count;
 
             double vap = 0;
-            for (double a : angles) vap += (a - avg_ang) * (a - avg_ang);
-            var_ang = vap / angles.size();
+            for (int i = 1; i < n - 1; i++) {
+                double a = angle(i);
+                if (a >= 0) vap += (a - avg_ang) * (a - avg_ang);
+            }
+            var_ang = vap / count;
         }
 
         F["angle_variance"] = var_ang;
-
-        return F;
     }
 
     std::string to_json(const FeatureMap& feats)
@@ -13,9 +13,10 @@ void Crossover::setContext(Random *random) {
     this->random = random;
 }
 
-List* Crossover::run(List *s1, List *s2) {
+List* Crossover::run(List *s1, List *s2, List *s) {
     auto start = std::chrono::high_resolution_clock::now();
-    List *s = realRun(s1, s2);
+    if (s == nullptr) s = new List();
+    realRun(s1, s2, s);
     auto end = std::chrono::high_resolution_clock::now();
     if (LOG) {
         std::cout << "parents values: " << s1->getValue() << " " << s2->getValue() << std::endl;
@@ -16,6 +16,8 @@ Crossover *CrossoverFactory::createCrossover(std::string crossover_type) {
         return new KSX();
     } else if (crossover_type == "EAX") {
         return new EAX();
+    } else if (crossover_type == "GPX") {
+        return new GPX();
     } else {
         std::cerr << "[ERROR] crossover function" << std::endl;
     }
@@ -11,8 +11,9 @@ EAX::EAX() {
     eax_threshold = 500;
     count = 0;
 }
+EAX::~EAX() {}
 
-List *EAX::realRun(List *s1, List *s2) {
+void EAX::realRun(List *s1, List *s2, List *s) {
     if (count == eax_threshold) strategy = 2;
     int size = s1->size();
 
@@ -31,7 +32,7 @@ List *EAX::realRun(List *s1, List *s2) {
     ESets();
     // std::cout << "E_sets size : "<< E_sets.size() << std::endl;
     intermediateSol();
-    return completeSol();
+    completeSol(s);
 }
 
 void EAX::adjList(List *s1, List *s2) {
@@ -189,13 +190,13 @@ void EAX::intermediateSol() {
     }
 }
 
-List* EAX::completeSol() {
+void EAX::completeSol(List* offspring) {
     int size = intermediate.size();
     std::vector<List*> sub_tours;
     std::vector<bool> visited(size, false);
     for (int i = 0; i < size; ++i) {
         if (visited[i]) continue;
-        List* s = new List();
+        List* s = sub_tours.empty() ? offspring : new List();
         int start = i, curr = start, pre = -1, next;
         while (true) {
             visited[curr] = true;
@@ -212,9 +213,10 @@ List* EAX::completeSol() {
 
     for (int i = 1; i < sub_tours.size(); ++i) {
         connectTours(sub_tours[0], sub_tours[i]);
+        // its nodes now belong to the first tour
+        sub_tours[i]->detach();
+        delete sub_tours[i];
     }
-
-    return sub_tours[0];
 }
 
 
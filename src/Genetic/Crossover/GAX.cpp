@@ -5,11 +5,12 @@
  **/
 
 #include "Genetic/Crossover/GAX.hpp"
+#include <algorithm>
 
 GAX::GAX() {}
 GAX::~GAX() {}
 
-List* GAX::realRun(List *s1, List *s2) {
+void GAX::realRun(List *s1, List *s2, List *offspring) {
     int size = s1->size();
     List sc1 = *s1, sc2 = *s2;
     List *s = nullptr;
@@ -19,6 +20,15 @@ List* GAX::realRun(List *s1, List *s2) {
         k = random->randomInt(size) + 1;  // size > 1
     }
     s = &sc1;
+    // the splicing mixes the nodes of both copies, they are deleted once at the end
+    std::vector<Node*> nodes;
+    for (List* sc : {&sc1, &sc2}) {
+        Node* q = sc->head();
+        for (int i = 0; i < size; ++i) {
+            nodes.emplace_back(q);
+            q = q->next;
+        }
+    }
     Node *h1 = sc1.head();
     Node *h2 = sc2.head();
     Node *p1 = h1;
@@ -57,7 +67,9 @@ List* GAX::realRun(List *s1, List *s2) {
     for (int i = 0; i < new_size; ++i) {
         if (existed[sp->id]) {
             Node *next = sp->next;
-            s->remove(sp);
+            sp->pre->next = next;
+            next->pre = sp->pre;
+            s->setSize(s->size() - 1);
             sp = next;
         } else {
             existed[sp->id] = true;
@@ -81,11 +93,27 @@ List* GAX::realRun(List *s1, List *s2) {
             }
             Node *n = new Node(*s2p);
             s->add(n, best_p);
+            nodes.emplace_back(n);
             existed[s2p->id] = true;
         }
         s2p = s2p->next;
     }
 
-    List* offspring = new List(*s);
-    return offspring;
+    // the offspring keeps the nodes of its ring, the others are deleted
+    std::vector<Node*> ring;
+    sp = head;
+    for (int i = 0; i < s->size(); ++i, sp = sp->next) ring.emplace_back(sp);
+    std::sort(ring.begin(), ring.end());
+    for (Node* n : nodes) {
+        if (!std::binary_search(ring.begin(), ring.end(), n)) delete n;
+    }
+    offspring->setHead(head);
+    offspring->setSize(s->size());
+    offspring->setValue(s->getValue());
+    offspring->setDistance(s->getDistance());
+    offspring->setFitness(s->getFitness());
+    offspring->cox_lp = s->cox_lp;
+    offspring->has_cox_lp = s->has_cox_lp;
+    sc1.detach();
+    sc2.detach();
 }
\ No newline at end of file
@@ -0,0 +1,82 @@
+/**
+ * GPX.cpp
+ * created on : Oct 17 2026
+ **/
+
+#include "Genetic/Crossover/GPX.hpp"
+
+GPX::GPX() {}
+GPX::~GPX() {}
+
+void GPX::realRun(List *s1, List *s2, List *s) {
+    int size = s1->size();
+
+    // the inner vectors keep their storage from the previous call
+    A_link.resize(size);
+    B_link.resize(size);
+    positions.resize(size);
+    for (int i = 0; i < size; ++i) {
+        A_link[i].assign(2, -1);
+        B_link[i].assign(2, -1);
+        positions[i].assign(4, -1);
+    }
+
+    tour_a.resize(size);
+    tour_b.resize(size);
+    Node *pa = s1->head();
+    Node *pb = s2->head();
+    for (int i = 0; i < size; ++i) {
+        A_link[pa->id][0] = pa->pre->id;
+        A_link[pa->id][1] = pa->next->id;
+
+        B_link[pb->id][0] = pb->pre->id;
+        B_link[pb->id][1] = pb->next->id;
+
+        positions[pa->id][0] = pa->x;
+        positions[pa->id][1] = pa->y;
+        positions[pb->id][2] = pb->x;
+        positions[pb->id][3] = pb->y;
+
+        tour_a[i] = pa->id;
+        tour_b[i] = pb->id;
+        pa = pa->next;
+        pb = pb->next;
+    }
+
+    // edges are weighted between the turning points of both parents, in the integral coordinates of LKH
+    xs.resize(size);
+    ys.resize(size);
+    for (int i = 0; i < size; ++i) {
+        xs[i] = int((positions[i][0] + positions[i][2]) / 2 * 1000);
+        ys[i] = int((positions[i][1] + positions[i][3]) / 2 * 1000);
+    }
+    lib.gpx(xs, ys, tour_a, tour_b, tour);
+
+    visited.assign(size, 0);
+    int count = 0;
+    for (int id : tour) {
+        if (id >= 0 && id < size && !visited[id]) {
+            visited[id] = 1;
+            ++count;
+        }
+    }
+    if (count != size || (int) tour.size() != size) {
+        std::cerr << "[GPX Error] invalid offspring, the first parent is kept" << std::endl;
+        tour = tour_a;
+    }
+
+    // like KSX, a node keeps the turning point of the parent its edges come from
+    Node* real_head = nullptr;
+    for (int i = 0; i < size; ++i) {
+        int id = tour[i];
+        int pre = tour[(i + size - 1) % size];
+        int next = tour[(i + 1) % size];
+        int from_a = (A_link[id][0] == pre || A_link[id][1] == pre) + (A_link[id][0] == next || A_link[id][1] == next);
+        int from_b = (B_link[id][0] == pre || B_link[id][1] == pre) + (B_link[id][0] == next || B_link[id][1] == next);
+        int p = from_a > from_b ? 0 : from_b > from_a ? 1 : random->randomInt(2);
+        Node* node = new Node(id, positions[id][2*p], positions[id][2*p+1]);
+        if (id == 0) real_head = node;
+        s->add(node);
+    }
+    s->setHead(real_head);
+}
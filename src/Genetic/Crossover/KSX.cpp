@@ -9,18 +9,20 @@
 KSX::KSX() {}
 KSX::~KSX() {}
 
-List *KSX::realRun(List *s1, List *s2) {
+void KSX::realRun(List *s1, List *s2, List *s) {
     int size = s1->size();
     this->k_step = random->randomInt(size / 2) + 1;
 
-    A_link.clear();
-    B_link.clear();
-    positions.clear();
-    visited.clear();
-    A_link.resize(size, std::vector<int> (2, -1));
-    B_link.resize(size, std::vector<int> (2, -1));
-    positions.resize(size, std::vector<double> {-1, -1, -1, -1});
-    visited.resize(size, false);
+    // the inner vectors keep their storage from the previous call
+    A_link.resize(size);
+    B_link.resize(size);
+    positions.resize(size);
+    for (int i = 0; i < size; ++i) {
+        A_link[i].assign(2, -1);
+        B_link[i].assign(2, -1);
+        positions[i].assign(4, -1);
+    }
+    visited.assign(size, false);
 
     Node *pa = s1->head();
     Node *pb = s2->head();
@@ -41,17 +43,17 @@ List *KSX::realRun(List *s1, List *s2) {
     }
 
     // construct the cycle
-    std::vector<std::vector<int>> completed_cycle;
+    completed_cycle.clear();
     while (true) {
-        if (completed_cycle.size() == size) break;    // tour has been completed
+        if ((int) completed_cycle.size() == size) break;    // tour has been completed
 
-        bool which_parent;
-        int next;
-        int insert_index;
+        bool which_parent = false;
+        int next = 0;
+        int insert_index = 0;
         if (completed_cycle.size() > 0) {
             int lucky = random->randomInt(completed_cycle.size());
             int i;
-            for (i = 0; i < completed_cycle.size(); ++i) {
+            for (i = 0; i < (int) completed_cycle.size(); ++i) {
                 insert_index = (lucky + i) % completed_cycle.size() + 1;
                 next = completed_cycle[insert_index-1][1];
                 if (A_link[next][0] != -1 || A_link[next][1] != -1) {
@@ -62,16 +64,16 @@ List *KSX::realRun(List *s1, List *s2) {
                     break;
                 }
             }
-            if (i == completed_cycle.size()) break;
+            if (i == (int) completed_cycle.size()) break;
         } else {
             which_parent = random->randomInt(2) == 0 ? true : false;
             next = random->randomInt(size);
             insert_index = 0;
         }
 
-        std::vector<std::vector<int>> cycle;
+        cycle.clear();
         if (!visited[next]){
-            cycle.emplace_back(std::vector<int> {which_parent, next});
+            cycle.push_back({which_parent, next});
             visited[next] = true;
         }
 
@@ -113,7 +115,7 @@ List *KSX::realRun(List *s1, List *s2) {
             if (link[next][1] == pre) link[next][1] = -1;
 
             if (!visited[next]){
-                cycle.emplace_back(std::vector<int> {which_parent, next});
+                cycle.push_back({which_parent, next});
                 visited[next] = true;
             }
 
@@ -126,9 +128,8 @@ List *KSX::realRun(List *s1, List *s2) {
     }
 
     // construct the solution
-    List* s = new List();
     Node* real_head = nullptr;
-    for (int i = 0; i < completed_cycle.size(); ++i) {
+    for (int i = 0; i < (int) completed_cycle.size(); ++i) {
         int p = completed_cycle[i][0];
         int id = completed_cycle[i][1];
         Node* node = new Node(id, positions[id][2*p], positions[id][2*p+1]);
@@ -136,5 +137,4 @@ List *KSX::realRun(List *s1, List *s2) {
         s->add(node);
     }
     s->setHead(real_head);
-    return s;
 }
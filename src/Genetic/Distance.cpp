@@ -148,8 +148,10 @@ double Distance::moveDistance(List *s1, List *s2) {
 double Distance::editDistance(List *s1, List *s2) {
     // edit distance
     int size = s1->size();
-    // lower triangular storage, i > j, for edit distance
-    std::vector<int> edges(size * (size - 1) / 2, 0);
+    // lower triangular storage, i > j, for edit distance. kept between calls, only the entries set below are
+    // cleared at the end
+    static thread_local std::vector<int> edges;
+    if (edges.size() < size * (size - 1) / 2) edges.assign(size * (size - 1) / 2, 0);
 
     Node *p1 = s1->head();
     Node *p2 = s2->head();
@@ -185,5 +187,15 @@ double Distance::editDistance(List *s1, List *s2) {
         p2 = p2->next;
     }
 
+    for (List* s : {s1, s2}) {
+        Node* p = s->head();
+        for (int i = 0; i < size; ++i) {
+            int id1 = p->id, id2 = p->next->id;
+            int ind1 = id1 > id2 ? id1 : id2;
+            int ind2 = id1 > id2 ? id2 : id1;
+            edges[ind1 * (ind1 - 1) / 2 + ind2] = 0;
+            p = p->next;
+        }
+    }
     return 100 * dist / (2 * size);
 }
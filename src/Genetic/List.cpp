@@ -31,22 +31,49 @@ List::List(const List& s) {
     }
 }
 
-List::~List() {}
-
-List& List::operator=(List& s) {
-    if (this == &s) {
-        return *this;
-    }
-
+List::~List() {
+    clear();
+}
 
-   Node* p = _head;
-    while (p) {
+void List::clear() {
+    Node* p = _head;
+    for (int i = 0; i < _size; ++i) {
         Node* next = p->next;
         delete p;
         p = next;
     }
+    detach();
+}
+
+void List::detach() {
     _head = nullptr;
     _size = 0;
+}
+
+void List::reset() {
+    clear();
+    value = 0;
+    distance = INT_MAX;
+    fitness = 0;
+    birth_iter = -1;
+    death_iter = -1;
+    instance_index = -1;
+    post_vnd_fitness_at_birth = -1;
+    final_fitness = -1;
+    pre_vnd_coords.clear();
+    was_inserted = false;
+    censored = false;
+    pre_vnd_value = -1;
+    post_vnd_value = -1;
+    cox_lp = 0.0;
+    has_cox_lp = false;
+}
+
+List& List::operator=(List& s) {
+    if (this == &s) {
+        return *this;
+    }
+    clear();
     value = s.value;
     distance = s.distance;
     fitness = s.fitness;
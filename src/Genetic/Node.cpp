@@ -5,6 +5,39 @@
  **/
 
 #include "Genetic/Node.hpp"
+#include "Defs.hpp"
+
+namespace {
+// the slabs are never given back, so a node may be deleted by another thread than the one that created it
+struct NodePool {
+    union Slot {
+        Slot* next;
+        alignas(Node) unsigned char bytes[sizeof(Node)];
+    };
+    Slot* free = nullptr;
+    long live = 0;      // allocated minus released by this thread
+    Slot* allocate() {
+        if (free == nullptr) {
+            Slot* slab = static_cast<Slot*>(::operator new(NODE_SLAB * sizeof(Slot)));
+            for (int i = 0; i < NODE_SLAB; ++i) {
+                slab[i].next = free;
+                free = &slab[i];
+            }
+        }
+        Slot* slot = free;
+        free = slot->next;
+        ++live;
+        return slot;
+    }
+    void release(void* p) {
+        Slot* slot = static_cast<Slot*>(p);
+        slot->next = free;
+        free = slot;
+        --live;
+    }
+};
+thread_local NodePool pool;
+}
 
 Node::Node(int id, double x, double y) {
     this->id = id;
@@ -39,6 +72,18 @@ double Node::distance(Node *n1, Node *n2) {
     return Geometry::EucDistance(x1, y1, x2, y2);
 }
 
+void* Node::operator new(std::size_t) {
+    return pool.allocate();
+}
+
+void Node::operator delete(void* p) {
+    if (p != nullptr) pool.release(p);
+}
+
+long Node::outstanding() {
+    return pool.live;
+}
+
 void Node::swap(Node *n1, Node *n2) {
     std::swap(n1->id, n2->id);
     std::swap(n1->x, n2->x);
@@ -18,7 +18,6 @@ Population::Population(Parameters* params)
     : neighbor(params->neighbor_size),
     ls(params),
     random(nullptr),          // ✅ ADD THIS
-    best_solution(nullptr),
     crossover(nullptr),
     ml_model(new SurvivalModel())   // ✅ ADD THIS
 
@@ -29,14 +28,12 @@ Population::Population(Parameters* params)
     this->population_size = params->population_size;
     this->fit_beta = params->fit_beta;
     this->dist_th = params->dist_th;
+    this->prune = params->prune;
+    this->adaptive_precision = params->adaptive_precision;
 }
 
 
 Population::~Population() {
-    for (int i = 0; i < population.size(); ++i) {
-        delete population[i];
-    }
-    delete best_solution;
     delete crossover;
     delete ml_model;   // ✅ ADD THIS
 
@@ -59,7 +56,7 @@ List* Population::randomSolution() {
     List* solution = new List();
     Node* head = new Node(0, centers[0][0], centers[0][1]);
     solution->add(head);
-    for (int i = 0; i < ids.size(); ++i) {
+    for (int i = 0; i < (int) ids.size(); ++i) {
         int id = ids[i];
         double theta = random->randomDoubleDistr(0, 2 * PI);
         double r = random->randomDoubleDistr(0, 1);
@@ -78,9 +75,9 @@ List* Population::kmeansSolution() {
     std::vector<std::vector<int>> groups = kmeans.getGroups();
     // random.permutation(groups);
     List* solution = new List();
-    for (int i = 0; i < groups.size(); ++i) {
+    for (int i = 0; i < (int) groups.size(); ++i) {
         random->permutation(groups[i]);
-        for (int j = 0; j < groups[i].size(); ++j) {
+        for (int j = 0; j < (int) groups[i].size(); ++j) {
             int id = groups[i][j];
             double x = centers[id][0], y = centers[id][1];
             if (id != 0) {
@@ -129,13 +126,15 @@ List* Population::initPopulation() {
         std::cout << "kmeans time : " << std::chrono::duration <double>(end_kmeans - start_kmeans).count() << " s" << std::endl;
     }
 
-    List* best = nullptr;
+    TourSnapshot best;
 
     for (int i = 0; i < population_size; ++i) {
         List* solution = initSolution();
         if (!solution) continue;
 
-        insertSolution(solution);
+        // a rejected solution is released with its handle unless it is the best
+        TourSnapshot handle(solution);
+        insertSolution(handle);
         if (ML_ENABLE && ML_MODEL == "COX" && !solution->has_cox_lp) {
             auto coords = solution->pre_vnd_coords;
             if (coords.empty()) {
@@ -155,7 +154,7 @@ List* Population::initPopulation() {
 
 
         if (!best || solution->getValue() < best->getValue()) {
-            best = solution;
+            best = handle;
         }
     }
 
@@ -163,7 +162,7 @@ List* Population::initPopulation() {
         throw std::runtime_error("Population initialization failed: no valid solutions");
     }
 
-    best_solution = new List(*best);
+    best_solution = best;
 
     std::sort(population.begin(), population.end(), [](List* s1, List* s2) {
         return s1->getValue() < s2->getValue();
@@ -210,7 +209,15 @@ std::pair<List*, List*> Population::chooseParent() {
 List* Population::nextPopulation(int patience) {
     std::pair<List*, List*> parents;
     double dist1 = 0, dist2 = 0;
-    List* offspring = nullptr;
+    // the offspring is built in a spare list, every stage below changes it in place
+    TourSnapshot buffer;
+    if (spares.empty()) {
+        buffer = TourSnapshot(new List());
+    } else {
+        buffer = std::move(spares.back());
+        spares.pop_back();
+    }
+    List* offspring = buffer;
     int try_times = 5;
 
     // ================= CREATE OFFSPRING =================
@@ -220,7 +227,8 @@ List* Population::nextPopulation(int patience) {
         }
         else {
             parents = chooseParent();
-            offspring = crossover->run(parents.first, parents.second);
+            offspring->reset();
+            crossover->run(parents.first, parents.second, offspring);
         }
         dist1 = Distance::run(offspring, parents.first);
         dist2 = Distance::run(offspring, parents.second);
@@ -239,7 +247,8 @@ List* Population::nextPopulation(int patience) {
     double pre_cost = offspring->getValue();
 
     // ================= PRE-VND RAW COORDS =================
-    std::vector<std::pair<double, double>> raw_coords;
+    std::vector<std::pair<double, double>>& raw_coords = offspring->pre_vnd_coords;
+    raw_coords.clear();
     Node* p_raw = offspring->head();
     for (int k = 0; k < offspring->size(); ++k) {
         raw_coords.push_back({ p_raw->x, p_raw->y });
@@ -249,7 +258,8 @@ List* Population::nextPopulation(int patience) {
     if (ML_ENABLE && current_iter > TRAINING_TIME) {
 
         // ---- feature extraction ----
-        auto feats = GeometryFeatures::extract(raw_coords);
+        GeometryFeatures::FeatureMap& feats = features;
+        GeometryFeatures::extract(raw_coords, feats);
         feats["pre_vnd_cost"] = pre_cost;
 
         if (ML_MODEL == "COX") {
@@ -274,6 +284,7 @@ List* Population::nextPopulation(int patience) {
                     std::cout << "[ML] Offspring rejected before VND (COX). "
                         << "score=" << score << "\n";
                 }
+                spares.push_back(std::move(buffer));
                 return best_solution;
             }
         }
@@ -305,6 +316,7 @@ List* Population::nextPopulation(int patience) {
                     std::cout << "[ML] Offspring rejected before VND ("
                         << ML_MODEL << "). Score=" << score << "\n";
                 }
+                spares.push_back(std::move(buffer));
                 return best_solution;
             }
         }
@@ -316,7 +328,51 @@ List* Population::nextPopulation(int patience) {
 
 
     // ================= VND IMPROVEMENT =================
-    offspring = ls.VND(offspring);
+    bool deferred = prune || adaptive_precision;
+    ls.VND(offspring, parents.first, parents.second, !deferred);
+
+    // ================= LOWER-BOUND PRUNING =================
+    // the sequence is final before the exact solve, so the distance part of insertSolution is known:
+    // a copy never enters, a distant offspring always does, the others only if they beat the best solution
+    std::vector<double>& distances = offspring_distances;
+    double min_dist = -1;
+    if (deferred) {
+        min_dist = minDistance(offspring, distances);             // reused by insertSolution
+        auto start_bound = std::chrono::high_resolution_clock::now();
+        double cutoff = min_dist > dist_th ? INFINITY : min_dist > 0 ? best_solution->getValue() : -INFINITY;
+        bool skip = prune && (cutoff == -INFINITY || (cutoff < INFINITY && ls.lowerBound(offspring, cutoff) >= cutoff));
+        auto end_bound = std::chrono::high_resolution_clock::now();
+        bound_time += std::chrono::duration<double>(end_bound - start_bound).count();
+        if (skip) {
+            ++prune_count;
+            if (LOG) std::cout << "exact solve skipped, min distance : " << min_dist << std::endl;
+        } else if (adaptive_precision && cutoff < INFINITY) {
+            // a distant offspring is always kept and solved tightly at once below. a close one is solved coarsely
+            // and, if it may beat the cutoff, re-solved tightly from the points the VND left as without adaptive
+            // precision, so the population and its survivors are the same as with tight solves only. the others
+            // keep the coarse value, the certified bound of the solver shows their optimum cannot reach the cutoff
+            vnd_points.clear();
+            Node* p = offspring->head();
+            for (int i = 0; i < offspring->size(); ++i, p = p->next) vnd_points.emplace_back(p->x, p->y);
+            double excess = ls.solve(offspring, SOLVER_COARSE_TOLERANCE);
+            auto end_coarse = std::chrono::high_resolution_clock::now();
+            coarse_time += std::chrono::duration<double>(end_coarse - end_bound).count();
+            ++coarse_count;
+            if (offspring->getValue() - excess < cutoff) {
+                p = offspring->head();
+                for (int i = 0; i < offspring->size(); ++i, p = p->next) p->x = vnd_points[i].first, p->y = vnd_points[i].second;
+                ls.solve(offspring);
+                tight_time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - end_coarse).count();
+                ++tight_count;
+            }
+            solve_time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - end_bound).count();
+            ++solve_count;
+        } else {
+            ls.solve(offspring);
+            solve_time += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - end_bound).count();
+            ++solve_count;
+        }
+    }
 
     // ================= POST-VND COST =================
     offspring->evaluate();
@@ -325,12 +381,12 @@ List* Population::nextPopulation(int patience) {
     // ================= SAVE TO OFFSPRING OBJECT =================
     offspring->pre_vnd_value = pre_cost;
     offspring->post_vnd_value = post_cost;
-    offspring->pre_vnd_coords = raw_coords;
     offspring->birth_iter = current_iter;
     offspring->instance_index = data->instance_index;
 
     // ================= INSERT & SURVIVAL MGMT =================
-    insertSolution(offspring);
+    if (min_dist < 0) min_dist = minDistance(offspring, distances);
+    insertSolution(buffer, min_dist, distances);
     populationManagement();
 
     offspring->post_vnd_fitness_at_birth = offspring->getFitness();
@@ -373,24 +429,48 @@ List* Population::nextPopulation(int patience) {
         std::cout << std::endl;
     }
 
+    // the offspring is read above even when it did not enter or was dropped right away. the lists that left the
+    // population are reused by the next offspring unless the best solution still shares one
+    if (!offspring->was_inserted) spares.push_back(std::move(buffer));
+    buffer = TourSnapshot();
+    for (TourSnapshot& s : retired) {
+        if (!s.shared()) spares.push_back(std::move(s));
+    }
+    retired.clear();
     return best_solution;
 }
 
 
-bool Population::insertSolution(List* s) {
-    double distance_threshold = dist_th;
+double Population::minDistance(List* s, std::vector<double>& distances) {
     double min_dist = INT_MAX;
-    std::vector<double> distances(population.size(), 0);
-    for (int i = 0; i < population.size(); ++i) {
+    distances.assign(population.size(), 0);
+    for (int i = 0; i < (int) population.size(); ++i) {
         double dist = Distance::run(s, population[i]);
         min_dist = std::min(min_dist, dist);
         distances[i] = std::min(population[i]->getDistance(), dist);
     }
+    return min_dist;
+}
+
+List* Population::solveExact(List* s) {
+    if (s == best_solution.get()) s = best_solution.edit();
+    ls.solveExact(s);
+    return s;
+}
+
+bool Population::insertSolution(const TourSnapshot& s) {
+    std::vector<double> distances;
+    double min_dist = minDistance(s, distances);
+    return insertSolution(s, min_dist, distances);
+}
+
+bool Population::insertSolution(const TourSnapshot& s, double min_dist, std::vector<double>& distances) {
+    double distance_threshold = dist_th;
     s->setDistance(min_dist);
     if ((min_dist > 0 && best_solution && s->getValue() < best_solution->getValue()) || min_dist > distance_threshold) {
         s->was_inserted = true;
 
-        for (int i = 0; i < population.size(); ++i) {
+        for (int i = 0; i < (int) population.size(); ++i) {
             population[i]->setDistance(distances[i]);
         }
         population.emplace_back(s);
@@ -407,28 +487,26 @@ bool Population::insertSolution(List* s) {
 
 void Population::updateDistances() {
     std::vector<double> distances(population.size(), INT_MAX);
-    for (int i = 0; i < population.size(); ++i) {
-        for (int j = i + 1; j < population.size(); ++j) {
+    for (int i = 0; i < (int) population.size(); ++i) {
+        for (int j = i + 1; j < (int) population.size(); ++j) {
             double dist = Distance::run(population[i], population[j]);
             distances[i] = std::min(distances[i], dist);
             distances[j] = std::min(distances[j], dist);
         }
     }
-    for (int i = 0; i < population.size(); ++i) {
+    for (int i = 0; i < (int) population.size(); ++i) {
         population[i]->setDistance(distances[i]);
     }
 }
 
 void Population::populationManagement() {
-    std::unordered_map<List*, std::vector<double>> rank;
-
-    // value rank
+    // value rank, kept in the fitness until the distance rank is known
     std::sort(population.begin(), population.end(), [](List* s1, List* s2) {
         return s1->getValue() < s2->getValue();
         });
 
-    for (int i = 0; i < population.size(); ++i) {
-        rank[population[i]].emplace_back(100.0 * i / (population.size() - 1));
+    for (int i = 0; i < (int) population.size(); ++i) {
+        population[i]->setFitness(100.0 * i / (population.size() - 1));
     }
 
     // distance rank
@@ -436,13 +514,9 @@ void Population::populationManagement() {
         return s1->getDistance() > s2->getDistance();
         });
 
-    for (int i = 0; i < population.size(); ++i) {
-        rank[population[i]].emplace_back(100.0 * i / (population.size() - 1));
-    }
-
-    for (int i = 0; i < population.size(); ++i) {
+    for (int i = 0; i < (int) population.size(); ++i) {
         double alpha = 1, beta = fit_beta;
-        double fitness = alpha * rank[population[i]][0] + beta * rank[population[i]][1];
+        double fitness = alpha * population[i]->getFitness() + beta * (100.0 * i / (population.size() - 1));
         population[i]->setFitness(fitness);
     }
 
@@ -478,7 +552,8 @@ void Population::populationManagement() {
             }
         }
 
-        // Actually delete them
+        // Actually delete them, at the end of nextPopulation
+        retired.insert(retired.end(), population.begin() + population_size, population.end());
         population.resize(population_size);
 
         // The rest stays the same
@@ -486,13 +561,12 @@ void Population::populationManagement() {
         updateDistances();
     }
 
-    List* best = *std::min_element(population.begin(), population.end(), [](List* s1, List* s2) {
+    const TourSnapshot& best = *std::min_element(population.begin(), population.end(), [](List* s1, List* s2) {
         return s1->getValue() < s2->getValue();
         });
 
     if (best->getValue() < best_solution->getValue()) {
-        delete best_solution;
-        best_solution = new List(*best);
+        best_solution = best;
     }
 
 }
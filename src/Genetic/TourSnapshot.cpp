@@ -0,0 +1,13 @@
+/**
+ * TourSnapshot.cpp
+ * created on : Oct 17 2026
+ **/
+
+#include "Genetic/TourSnapshot.hpp"
+
+TourSnapshot::TourSnapshot(List* s) : list(s) {}
+
+List* TourSnapshot::edit() {
+    if (shared()) list = std::make_shared<List>(*list);
+    return list.get();
+}
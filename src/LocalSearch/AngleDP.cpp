@@ -0,0 +1,146 @@
+/**
+ * AngleDP.cpp
+ * created on : Oct 17 2026
+ **/
+
+#include "LocalSearch/AngleDP.hpp"
+#include "Utils/AlhazenProblem.hpp"
+#include <cmath>
+
+typedef std::vector<double> Vec;
+
+AngleDP::AngleDP(int angles) : n(0), k(std::max(angles, 1) + 3) {}
+AngleDP::~AngleDP() {}
+
+double AngleDP::solve(int n, const double* cx, const double* cy, const double* r, Vec& x, Vec& y) {
+    this->n = n;
+    // the current points start strictly feasible, they are candidates of every disk
+    for (int i = 0; i < n; ++i) {
+        double qx = x[i] - cx[i], qy = y[i] - cy[i];
+        double q = std::sqrt(qx * qx + qy * qy);
+        if (q > r[i]) x[i] = cx[i] + r[i] / q * qx, y[i] = cy[i] + r[i] / q * qy;
+    }
+    if (n < 3) return refine(cx, cy, r, x, y);
+    // the first rounds sample the boundaries, the next ones circles around the points that shrink by half
+    double radius = 1;
+    for (int round = 0; round < SOLVER_DP_ROUNDS; ++round) {
+        candidates(cx, cy, r, x, y, round < 2 ? -1 : radius *= 0.5);
+        pass(round % 2 == 0 ? 0 : n / 2, x, y);
+    }
+    return refine(cx, cy, r, x, y);
+}
+
+void AngleDP::candidates(const double* cx, const double* cy, const double* r, const Vec& x, const Vec& y, double radius) {
+    px.resize(n * k), py.resize(n * k);
+    for (int i = 0; i < n; ++i) {
+        double* qx = &px[i * k];
+        double* qy = &py[i * k];
+        auto clip = [&](int j, double ox, double oy) {
+            ox -= cx[i], oy -= cy[i];
+            double o = std::sqrt(ox * ox + oy * oy);
+            double scale = o > r[i] ? r[i] / o : 1;
+            qx[j] = cx[i] + scale * ox;
+            qy[j] = cy[i] + scale * oy;
+        };
+        for (int j = 0; j + 3 < k; ++j) {
+            double angle = 2 * PI * j / (k - 3);
+            if (radius < 0) {
+                qx[j] = cx[i] + r[i] * std::cos(angle);
+                qy[j] = cy[i] + r[i] * std::sin(angle);
+                continue;
+            }
+            clip(j, x[i] + radius * r[i] * std::cos(angle), y[i] + radius * r[i] * std::sin(angle));
+        }
+        // the points of the neighbors let overlapping disks share a point
+        int h = i == 0 ? n - 1 : i - 1, l = i + 1 == n ? 0 : i + 1;
+        clip(k - 3, x[h], y[h]);
+        clip(k - 2, x[l], y[l]);
+        qx[k - 1] = x[i], qy[k - 1] = y[i];
+    }
+}
+
+double AngleDP::pass(int start, Vec& x, Vec& y) {
+    cost.resize(k), next_cost.resize(k), dist.resize(k);
+    from.resize(n * k);
+    double sx = x[start], sy = y[start];
+    int first = (start + 1) % n;
+    for (int j = 0; j < k; ++j) {
+        double dx = px[first * k + j] - sx, dy = py[first * k + j] - sy;
+        cost[j] = std::sqrt(dx * dx + dy * dy);
+    }
+    // min-plus product of the cost vector with the distances between the candidates of two disks
+    for (int t = 2; t < n; ++t) {
+        int i = (start + t) % n, h = (start + t - 1) % n;
+        const double* hx = &px[h * k];
+        const double* hy = &py[h * k];
+        for (int j = 0; j < k; ++j) {
+            double qx = px[i * k + j], qy = py[i * k + j];
+            for (int m = 0; m < k; ++m) {
+                double dx = hx[m] - qx, dy = hy[m] - qy;
+                dist[m] = cost[m] + std::sqrt(dx * dx + dy * dy);
+            }
+            double best = dist[0];
+            int arg = 0;
+            for (int m = 1; m < k; ++m) {
+                arg = dist[m] < best ? m : arg;
+                best = std::min(best, dist[m]);
+            }
+            next_cost[j] = best;
+            from[i * k + j] = arg;
+        }
+        cost.swap(next_cost);
+    }
+    int last = (start + n - 1) % n;
+    double best = INFINITY;
+    int arg = 0;
+    for (int j = 0; j < k; ++j) {
+        double dx = px[last * k + j] - sx, dy = py[last * k + j] - sy;
+        double value = cost[j] + std::sqrt(dx * dx + dy * dy);
+        if (value < best) best = value, arg = j;
+    }
+    for (int t = n - 1; t >= 1; --t) {
+        int i = (start + t) % n;
+        x[i] = px[i * k + arg], y[i] = py[i * k + arg];
+        if (t > 1) arg = from[i * k + arg];
+    }
+    return best;
+}
+
+double AngleDP::refine(const double* cx, const double* cy, const double* r, Vec& x, Vec& y) {
+    auto length = [&]() {
+        double value = 0;
+        for (int i = 0; i < n; ++i) {
+            int j = i + 1 == n ? 0 : i + 1;
+            value += std::sqrt((x[i] - x[j]) * (x[i] - x[j]) + (y[i] - y[j]) * (y[i] - y[j]));
+        }
+        return value;
+    };
+    double value = length();
+    if (n < 2) return value;
+    for (int sweep = 0; sweep < SOLVER_DP_SWEEPS; ++sweep) {
+        for (int i = 0; i < n; ++i) {
+            if (r[i] <= SOLVER_MIN_RADIUS) continue;
+            int h = i == 0 ? n - 1 : i - 1, j = i + 1 == n ? 0 : i + 1;
+            double ax = x[h], ay = y[h], bx = x[j], by = y[j];
+            auto local = [&](double qx, double qy) {
+                return std::sqrt((qx - ax) * (qx - ax) + (qy - ay) * (qy - ay)) + std::sqrt((qx - bx) * (qx - bx) + (qy - by) * (qy - by));
+            };
+            // a segment between the neighbors that crosses the disk is the shortest, else the reflection point is
+            double ex = bx - ax, ey = by - ay;
+            double e = ex * ex + ey * ey;
+            double t = e > 0 ? std::max(0.0, std::min(1.0, ((cx[i] - ax) * ex + (cy[i] - ay) * ey) / e)) : 0;
+            double qx = ax + t * ex, qy = ay + t * ey;
+            if ((qx - cx[i]) * (qx - cx[i]) + (qy - cy[i]) * (qy - cy[i]) > r[i] * r[i]) {
+                AlhazenProblem ap(ax, ay, bx, by, cx[i], cy[i], r[i]);
+                auto position = ap.solve();
+                qx = position[0], qy = position[1];
+            }
+            if (local(qx, qy) < local(x[i], y[i])) x[i] = qx, y[i] = qy;
+        }
+        double current = length();
+        bool stalled = value - current <= SOLVER_TOLERANCE * current;
+        value = current;
+        if (stalled) break;
+    }
+    return value;
+}
@@ -18,24 +18,26 @@ void Greed::setContext(Centers &centers) {
 void Greed::run(List* &s) {
     auto start = std::chrono::high_resolution_clock::now();
 
-    List* ns = new List(*s);
     // size must be equal to or greater than 3
-    if (ns->size() < 3) return;
+    if (s->size() < 3) return;
+    // the points are moved in place, the old ones are put back if the tour is not shorter
+    old_x.clear(), old_y.clear();
     double value = 0;
-    Node* p = ns->head()->next;
-    while (p != ns->head()) {
+    Node* p = s->head()->next;
+    while (p != s->head()) {
         int id = p->id;
+        old_x.push_back(p->x), old_y.push_back(p->y);
         value += updatePosition(p, centers[id][0], centers[id][1], centers[id][2]);
         p = p->next;
     }
     value += Node::distance(p->pre, p);
-    ns->setValue(value);
-    if (ns->getValue() < s->getValue()) {
-        delete s;
-        s = ns;
-    } else if (LOG){
-        std::cout << "[GREED] not accept" << std::endl;
-    };
+    if (value < s->getValue()) {
+        s->setValue(value);
+    } else {
+        p = s->head()->next;
+        for (int i = 0; i < (int) old_x.size(); ++i, p = p->next) p->x = old_x[i], p->y = old_y[i];
+        if (LOG) std::cout << "[GREED] not accept" << std::endl;
+    }
 
     auto end = std::chrono::high_resolution_clock::now();
     if (LOG) std::cout << "greed solution : " << s->getValue() << " time : " << std::chrono::duration<double> (end - start).count() << " s" << std::endl;
@@ -63,13 +65,14 @@ double Greed::updatePosition(Node* node, double x0, double y0, double r) {
         node->x = x2, node->y = y2;
         return Node::distance(pre, node);
     } else {
-        auto intersections = Geometry::solveLineIntersectSphere(x1, y1, x2, y2, x0, y0, r);
-        if (intersections.size() == 2) {
-            node->x = intersections[0][0];
-            node->y = intersections[0][1];
-        } else if (intersections.size() == 1){
-            node->x = intersections[0][0];
-            node->y = intersections[0][1];
+        double ix[2], iy[2];
+        int count = Geometry::lineIntersectSphere(x1, y1, x2, y2, x0, y0, r, ix, iy);
+        if (count == 2) {
+            node->x = ix[0];
+            node->y = iy[0];
+        } else if (count == 1){
+            node->x = ix[0];
+            node->y = iy[0];
         } else {
             AlhazenProblem ap(x1, y1, x2, y2, x0, y0, r);
             auto position = ap.solve();
@@ -81,8 +84,7 @@ double Greed::updatePosition(Node* node, double x0, double y0, double r) {
     return Node::distance(pre, node);
 }
 
-std::vector<double> Greed::approxPosition(double x0, double y0, double r, Node* pre, Node* next) {
-    double x, y;
+void Greed::approxPosition(double x0, double y0, double r, Node* pre, Node* next, double& x, double& y) {
     double x1 = pre->x, y1 = pre->y, x2 = next->x, y2 = next->y;
     // judge points in or out circle
     bool in_circle1 = Geometry::inCircle(x1, y1, x0, y0, r);
@@ -99,23 +101,23 @@ std::vector<double> Greed::approxPosition(double x0, double y0, double r, Node*
     } else if (in_circle2) {
         x = x2, y = y2;
     } else {
-        auto intersections = Geometry::solveLineIntersectSphere(x1, y1, x2, y2, x0, y0, r);
-        if (intersections.size() == 2) {
-            x = (intersections[0][0] + intersections[1][0]) / 2;
-            y = (intersections[0][1] + intersections[1][1]) / 2;
-        } else if (intersections.size() == 1){
-            x = intersections[0][0];
-            y = intersections[0][1];
+        double ix[2], iy[2];
+        int count = Geometry::lineIntersectSphere(x1, y1, x2, y2, x0, y0, r, ix, iy);
+        if (count == 2) {
+            x = (ix[0] + ix[1]) / 2;
+            y = (iy[0] + iy[1]) / 2;
+        } else if (count == 1){
+            x = ix[0];
+            y = iy[0];
         } else {
             double mid_point_x = (pre->x + next->x) / 2;
             double mid_point_y = (pre->y + next->y) / 2;
-            auto intersections = Geometry::solveLineIntersectSphere(mid_point_x, mid_point_y, x0, y0, x0, y0, r);
-            if (intersections.size() != 1) std::cout << "ERROR : only one intersection !!!" << std::endl;
-            x = intersections[0][0];
-            y = intersections[0][1];
+            int count = Geometry::lineIntersectSphere(mid_point_x, mid_point_y, x0, y0, x0, y0, r, ix, iy);
+            if (count != 1) std::cout << "ERROR : only one intersection !!!" << std::endl;
+            x = ix[0];
+            y = iy[0];
         }
     }
-    return std::vector<double> {x, y};
 }
 
 bool Greed::inLine(double x0, double y0, double r, Node* pre, Node* next) {
@@ -125,7 +127,6 @@ bool Greed::inLine(double x0, double y0, double r, Node* pre, Node* next) {
     bool in_circle2 = Geometry::inCircle(x2, y2, x0, y0, r);
     if (in_circle1 || in_circle2) return true;
     // have intersections
-    auto intersections = Geometry::solveLineIntersectSphere(x1, y1, x2, y2, x0, y0, r);
-    if (intersections.size() > 0) return true;
-    return false;
+    double ix[2], iy[2];
+    return Geometry::lineIntersectSphere(x1, y1, x2, y2, x0, y0, r, ix, iy) > 0;
 }
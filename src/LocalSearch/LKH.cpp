@@ -13,10 +13,19 @@
 #include <sstream>
 #include <algorithm>
 
-LKH::LKH() {}
+std::atomic<int> LKH::instance_count{0};
+
+LKH::LKH(std::string backend, int workers, double cache_tolerance, bool fix_edges, bool adaptive, std::string cost,
+         double point_weight)
+    : backend(backend), workers(workers), fix_edges(fix_edges), cost(cost), point_weight(point_weight),
+      cache(cache_tolerance), initial_control(adaptive), offspring_control(adaptive) {
+    if (cost == "DISK" && backend == "FILE") {
+        std::cerr << "[LKH Warning] DISK cost needs the LIB or POOL backend, FILE uses POINT" << std::endl;
+    }
+}
 
 LKH::~LKH() {
-    if (std::filesystem::exists(root_dir)) {
+    if (!root_dir.empty() && std::filesystem::exists(root_dir)) {
         try {
             std::filesystem::remove_all(root_dir);
         }
@@ -26,36 +35,259 @@ LKH::~LKH() {
     }
 }
 
-void LKH::setContext(std::string timestamp, int random_value) {
+void LKH::setContext(std::string timestamp, int random_value, const Centers& centers) {
+    this->centers = centers;
+    // one directory per LKH object, the destructor removes it
+    std::string suffix = timestamp + "_" + std::to_string(random_value) + "_" + std::to_string(instance_count++) + "/";
     if (ENV == "LOCAL") {
         lkh_exe = LOCAL_LKH_EXE;
-        root_dir = LOCAL_LKH_TMP_ROOT;
+        root_dir = LOCAL_LKH_TMP_ROOT + suffix;
     }
     else if (ENV == "SERVER") {
         lkh_exe = SERVER_LKH_EXE;
-        root_dir = SERVER_LKH_TMP_ROOT + "_" + timestamp + "_" + std::to_string(random_value) + "/";
+        root_dir = SERVER_LKH_TMP_ROOT + "_" + suffix;
     }
 
-    params_file = root_dir + "params.par";
-    problem_file = root_dir + "problem.tsp";
-    tour_file = root_dir + "tour.txt";
-    result_file = root_dir + "result.txt";
+    if (backend == "POOL" && pool.size() == 0) {
+        pool.start(LKH_WORKER_EXE, workers);
+    }
 }
 
-List* LKH::run(List* solution, bool adapted) {
+List* LKH::run(List* solution, bool adapted, List* parent1, List* parent2) {
     auto start = std::chrono::high_resolution_clock::now();
-    ListAdapter la;
+    // one workspace per thread, concurrent calls share nothing mutable
+    static thread_local Workspace w;
+    ListAdapter& la = w.la;
+    solution->evaluate();
+    double before = solution->getValue();
+
+    // ids change in the reduced list, detect the common edges first
+    w.fix_next.clear();
+    if (parent1 && parent2) {
+        inheritedEdges(solution, parent1, parent2, w);
+    }
+    const std::vector<bool>& fix_next = w.fix_next;
 
     if (adapted) {
         solution = la.real2Reduced(solution);
+    } else {
+        la.identity(solution->size());
+    }
+    const Groups& groups = la.getGroups();
+
+    // the edge leaving a merged node is the one leaving its last real node
+    std::vector<std::pair<int, int>>& fixed = w.fixed;
+    fixed.clear();
+    if (!fix_next.empty()) {
+        Node* p = solution->head();
+        for (int i = 0; i < solution->size(); ++i) {
+            if (fix_next[groups.last(p->id)]) fixed.emplace_back(p->id, p->next->id);
+            p = p->next;
+        }
+    }
+    double change = 1.0 - double(fixed.size()) / solution->size();
+    if (LOG && !fix_next.empty()) {
+        // without fix_edges the common edges only tell the controller how much the offspring changed
+        std::cout << (fix_edges ? "LKH fixed edges : " : "LKH common edges : ") << fixed.size() << " / "
+                  << solution->size() << std::endl;
+    }
+    if (!fix_edges) fixed.clear();
+
+    LKHController& control = adapted ? offspring_control : initial_control;
+    LKHController::Decision decision = control.choose(solution->size(), change);
+
+    // the controller rates the effort on the time of LKH alone, not on the reduction around it
+    auto lkh_start = std::chrono::high_resolution_clock::now();
+    bool solved = true;
+    if (backend == "LIB" || backend == "POOL") {
+        solveMemory(solution, groups, fixed, decision.effort, w);
+    } else if (backend == "FILE") {
+        solved = solveFile(solution, groups, fixed, decision.effort, w);
+    } else {
+        std::cerr << "[LKH Error] unknown backend " << backend << std::endl;
+        exit(1);
+    }
+    double lkh_seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - lkh_start).count();
+
+    // the nodes are relinked in the order of LKH, the head is the first of its tour
+    if (solved) {
+        int size = solution->size();
+        w.nodes.resize(size);
+        Node* p = solution->head();
+        for (int i = 0; i < size; ++i) {
+            w.nodes[p->id] = p;
+            p = p->next;
+        }
+        for (int i = 0; i < size; ++i) {
+            Node* a = w.nodes[w.tour[i]];
+            Node* b = w.nodes[w.tour[i + 1 == size ? 0 : i + 1]];
+            a->next = b;
+            b->pre = a;
+        }
+        solution->setHead(w.nodes[w.tour[0]]);
+    }
+    List* new_solution = solution;
+
+    // the merged nodes are linked back after their reduced node
+    if (adapted) {
+        new_solution = la.reduced2Real(new_solution);
     }
 
-    write(solution);
+    new_solution->evaluate();
+
+    auto end = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    if (LOG)
+        std::cout << "LKH solution : " << new_solution->getValue()
+        << " time : " << seconds << " s"
+        << " effort : " << decision.effort.move_type << "/" << decision.effort.runs << "/" << decision.effort.max_trials
+        << std::endl;
+    // after the log of this call, a new level is logged after the result it was chosen from
+    control.record(decision, before - new_solution->getValue(), lkh_seconds);
+
+    return new_solution;
+}
+
+void LKH::inheritedEdges(List* solution, List* parent1, List* parent2, Workspace& w) {
+    int size = solution->size();
+    std::vector<bool>& fix_next = w.fix_next;
+    fix_next.assign(size, false);
+    if (parent1->size() != size || parent2->size() != size) return;
+
+    std::vector<int>& links = w.links;
+    links.assign(4 * size, -1);
+    Node* p1 = parent1->head();
+    Node* p2 = parent2->head();
+    for (int i = 0; i < size; ++i) {
+        links[4 * p1->id] = p1->pre->id;
+        links[4 * p1->id + 1] = p1->next->id;
+        links[4 * p2->id + 2] = p2->pre->id;
+        links[4 * p2->id + 3] = p2->next->id;
+        p1 = p1->next;
+        p2 = p2->next;
+    }
+
+    std::vector<Node*>& nodes = w.nodes;
+    std::vector<char>& inherited = w.inherited;
+    nodes.resize(size);
+    inherited.resize(size);
+    Node* p = solution->head();
+    for (int i = 0; i < size; ++i) {
+        nodes[i] = p;
+        const int* l = &links[4 * p->id];
+        int next = p->next->id;
+        inherited[i] = (l[0] == next || l[1] == next) && (l[2] == next || l[3] == next);
+        p = p->next;
+    }
+
+    // start after a new edge, so that no run wraps around
+    int first = std::find(inherited.begin(), inherited.end(), 0) - inherited.begin();
+    if (first == size) return;
+    for (int k = 1; k <= size; ) {
+        int begin = (first + k) % size;
+        if (!inherited[begin]) {
+            ++k;
+            continue;
+        }
+        int length = 0;
+        while (inherited[(begin + length) % size]) ++length;
+        // keep a margin free at both ends so LKH can reconnect the run
+        for (int j = LKH_FIX_MARGIN; j < length - LKH_FIX_MARGIN; ++j) {
+            fix_next[nodes[(begin + j) % size]->id] = true;
+        }
+        k += length;
+    }
+}
+
+void LKH::solveMemory(List* solution, const Groups& groups, const std::vector<std::pair<int, int>>& fixed,
+                      const LKHEffort& effort, Workspace& w) {
+    int size = solution->size();
+    std::vector<double>& xs = w.xs;
+    std::vector<double>& ys = w.ys;
+    std::vector<int>& tour = w.tour;
+    std::vector<std::array<double, 2>>& positions = w.positions;
+    xs.resize(size), ys.resize(size), tour.resize(size);
+    positions.resize(size);
+    Node* p = solution->head();
+    for (int i = 0; i < size; ++i) {
+        positions[p->id][0] = p->x;
+        positions[p->id][1] = p->y;
+        // same integral coordinates as the problem file of the FILE backend
+        xs[p->id] = int(p->x * 1000);
+        ys[p->id] = int(p->y * 1000);
+        tour[i] = p->id;
+        p = p->next;
+    }
+
+    // a merged node takes the smallest of its disks, the point is in all of them
+    LKHDisks& disks = w.disks;
+    LKHDisks* d = nullptr;
+    if (cost == "DISK" && !centers.empty()) {
+        disks.x.resize(size);
+        disks.y.resize(size);
+        disks.r.resize(size);
+        disks.point_weight = point_weight;
+        for (int i = 0; i < size; ++i) {
+            int target = groups.first(i);
+            for (int k = groups.start[i]; k < groups.start[i + 1]; ++k) {
+                if (centers[groups.ids[k]][2] < centers[target][2]) target = groups.ids[k];
+            }
+            disks.x[i] = int(centers[target][0] * 1000);
+            disks.y[i] = int(centers[target][1] * 1000);
+            disks.r[i] = int(centers[target][2] * 1000);
+        }
+        d = &disks;
+    }
+
+    // reuse the penalties and candidates of an earlier call if the turning points barely moved
+    // fixed edges cost nothing in LKH, so penalties computed with them are not stored
+    LKHCandidates& candidates = w.candidates;
+    candidates.given = false;
+    bool cached = cache.lookup(groups, positions, candidates);
+    LKHCandidates* c = cached || (cache.enabled() && fixed.empty()) ? &candidates : nullptr;
+    if (backend == "POOL") {
+        tour = pool.solve(xs, ys, tour, effort, c, fixed, d);
+    } else {
+        lib.solve(xs, ys, tour, w.result, effort, c, fixed, d);
+        tour.swap(w.result);
+    }
+    if (c && !cached) {
+        cache.store(groups, positions, candidates);
+    }
+}
+
+LKH::Task LKH::makeTask() {
+    // one sub directory per call, so that concurrent calls do not clobber each other's files
+    Task task;
+    task.dir = root_dir + "task_" + std::to_string(task_count++) + "/";
+    task.params_file = task.dir + "params.par";
+    task.problem_file = task.dir + "problem.tsp";
+    task.tour_file = task.dir + "tour.txt";
+    task.result_file = task.dir + "result.txt";
+    if (cache.enabled()) {
+        task.pi_file = task.dir + "problem.pi";
+        task.candidate_file = task.dir + "problem.cand";
+    }
+    return task;
+}
+
+bool LKH::solveFile(List* solution, const Groups& groups, const std::vector<std::pair<int, int>>& fixed,
+                    const LKHEffort& effort, Workspace& w) {
+    Task task = makeTask();
+    task.fixed = fixed;
+    task.effort = effort;
+    write(solution, task);
+    // LKH reads the files if they exist, otherwise it writes them
+    LKHCandidates candidates;
+    bool cached = cache.lookup(groups, task.positions, candidates);
+    if (cached) {
+        writeCandidates(task, candidates);
+    }
 
 #ifdef _WIN32
     // Windows: ensure full path and correct environment
     std::filesystem::path exePath = std::filesystem::absolute(lkh_exe);
-    std::filesystem::path paramPath = std::filesystem::absolute(params_file);
+    std::filesystem::path paramPath = std::filesystem::absolute(task.params_file);
 
     std::string str = "\"" + exePath.string() + "\" \"" + paramPath.string() + "\"";
     std::string cmd = "C:\\Windows\\System32\\cmd.exe /C \"" + str + "\"";
@@ -63,7 +295,7 @@ List* LKH::run(List* solution, bool adapted) {
     std::cout << "[DEBUG CMD] Executing: " << cmd << std::endl;
     int result = std::system(cmd.c_str());
 #else
-    std::string str = lkh_exe + " " + params_file;
+    std::string str = lkh_exe + " " + task.params_file;
     int result = std::system(str.c_str());
 #endif
 
@@ -77,25 +309,22 @@ List* LKH::run(List* solution, bool adapted) {
         std::cerr << "[LKH Error] LKH execution failed with code " << result << std::endl;
     }
 
-    List* new_solution = read();
-
-    if (adapted) {
-        new_solution = la.reduced2Real(new_solution);
+    bool solved = read(task, w.tour);
+    if (cache.enabled() && !cached && fixed.empty() && readCandidates(task, candidates)) {
+        cache.store(groups, task.positions, candidates);
     }
-
-    new_solution->evaluate();
-
-    auto end = std::chrono::high_resolution_clock::now();
-    if (LOG)
-        std::cout << "LKH solution : " << new_solution->getValue()
-        << " time : " << std::chrono::duration<double>(end - start).count()
-        << " s" << std::endl;
-
-    return new_solution;
+    try {
+        std::filesystem::remove_all(task.dir);
+    }
+    catch (const std::exception& e) {
+        std::cout << "[LKH Error] " << e.what() << std::endl;
+    }
+    return solved;
 }
 
-void LKH::write(List* solution) {
-    positions.resize(solution->size(), std::vector<double>{-1, -1});
+void LKH::write(List* solution, Task& task) {
+    auto& positions = task.positions;
+    positions.resize(solution->size(), std::array<double, 2>{-1, -1});
     Node* p = solution->head();
     for (int i = 0; i < solution->size(); ++i) {
         positions[p->id][0] = p->x;
@@ -104,13 +333,13 @@ void LKH::write(List* solution) {
     }
 
     try {
-        if (!std::filesystem::exists(root_dir)) {
-            std::filesystem::create_directories(root_dir);
+        if (!std::filesystem::exists(task.dir)) {
+            std::filesystem::create_directories(task.dir);
         }
 
         // Write params
         {
-            std::ofstream params_out(params_file);
+            std::ofstream params_out(task.params_file);
             if (params_out.is_open()) {
                 auto normPath = [](std::string path) {
 #ifdef _WIN32
@@ -119,47 +348,59 @@ void LKH::write(List* solution) {
                     return path;
                     };
 
-                params_out << "PROBLEM_FILE = " << normPath(problem_file) << "\n";
-                params_out << "TOUR_FILE = " << normPath(result_file) << "\n";
-                params_out << "INITIAL_TOUR_FILE = " << normPath(tour_file) << "\n";
-                params_out << "MOVE_TYPE = 5\n";
-                params_out << "RUNS = 1\n";
+                params_out << "PROBLEM_FILE = " << normPath(task.problem_file) << "\n";
+                params_out << "TOUR_FILE = " << normPath(task.result_file) << "\n";
+                params_out << "INITIAL_TOUR_FILE = " << normPath(task.tour_file) << "\n";
+                if (!task.pi_file.empty()) {
+                    params_out << "PI_FILE = " << normPath(task.pi_file) << "\n";
+                    params_out << "CANDIDATE_FILE = " << normPath(task.candidate_file) << "\n";
+                }
+                params_out << "MOVE_TYPE = " << task.effort.move_type << "\n";
+                params_out << "RUNS = " << task.effort.runs << "\n";
                 params_out << "TRACE_LEVEL = 0\n";
-                params_out << "MAX_TRIALS = 10\n";
+                params_out << "MAX_TRIALS = " << task.effort.max_trials << "\n";
                 params_out.close();
             }
             else {
-                std::cout << "[LKH Error] Unable to open params file: " << params_file << std::endl;
+                std::cout << "[LKH Error] Unable to open params file: " << task.params_file << std::endl;
             }
         }
 
         // Write problem
         {
-            std::ofstream out(problem_file);
+            std::ofstream out(task.problem_file);
             if (out.is_open()) {
                 out << "NAME : lhk\n";
                 out << "TYPE : TSP\n";
                 out << "DIMENSION : " << solution->size() << "\n";
                 out << "EDGE_WEIGHT_TYPE : EUC_2D\n";
                 out << "NODE_COORD_SECTION\n";
-                for (int i = 0; i < positions.size(); ++i) {
+                for (int i = 0; i < (int) positions.size(); ++i) {
                     out << i + 1 << " " << int(positions[i][0] * 1000) << " " << int(positions[i][1] * 1000) << "\n";
                 }
+                if (!task.fixed.empty()) {
+                    out << "FIXED_EDGES_SECTION\n";
+                    for (auto& e : task.fixed) {
+                        out << e.first + 1 << " " << e.second + 1 << "\n";
+                    }
+                    out << "-1\n";
+                }
                 out << "EOF\n";
                 out.close();
             }
             else {
-                std::cout << "[LKH Error] Unable to open problem file: " << problem_file << std::endl;
+                std::cout << "[LKH Error] Unable to open problem file: " << task.problem_file << std::endl;
             }
         }
 
         // Write tour
         {
-            std::ofstream tf_out(tour_file);
+            std::ofstream tf_out(task.tour_file);
             if (tf_out.is_open()) {
                 p = solution->head();
                 tf_out << "TOUR_SECTION\n";
                 for (int i = 0; i < solution->size(); ++i) {
+                    task.tour.push_back(p->id);
                     tf_out << p->id + 1 << "\n";
                     p = p->next;
                 }
@@ -168,7 +409,7 @@ void LKH::write(List* solution) {
                 tf_out.close();
             }
             else {
-                std::cout << "[LKH Error] Unable to open tour file: " << tour_file << std::endl;
+                std::cout << "[LKH Error] Unable to open tour file: " << task.tour_file << std::endl;
             }
         }
     }
@@ -177,15 +418,15 @@ void LKH::write(List* solution) {
     }
 }
 
-List* LKH::read() {
-    std::ifstream in(result_file);
+bool LKH::read(Task& task, std::vector<int>& tour) {
+    std::ifstream in(task.result_file);
     if (!in.is_open()) {
-        std::cerr << "[LKH Error] Could not open result file: " << result_file << std::endl;
-        return nullptr;
+        std::cerr << "[LKH Error] Could not open result file: " << task.result_file << ", the tour is kept" << std::endl;
+        return false;
     }
 
     std::string data;
-    List* solution = new List();
+    tour.clear();
 
     while (std::getline(in, data) && data != "TOUR_SECTION") {
         // Skip until TOUR_SECTION
@@ -194,12 +435,75 @@ List* LKH::read() {
     while (std::getline(in, data) && data != "-1") {
         std::istringstream iss(data);
         int id;
-        if (iss >> id) {
-            Node* node = new Node(id - 1, positions[id - 1][0], positions[id - 1][1]);
-            solution->add(node);
-        }
+        if (iss >> id) tour.push_back(id - 1);
     }
 
     in.close();
-    return solution;
+    if (tour.size() != task.positions.size()) {
+        std::cerr << "[LKH Error] Incomplete result file: " << task.result_file << ", the tour is kept" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void LKH::writeCandidates(Task& task, LKHCandidates& candidates) {
+    int size = candidates.pi.size();
+    int width = candidates.width;
+    std::ofstream pi_out(task.pi_file);
+    std::ofstream cand_out(task.candidate_file);
+    if (!pi_out.is_open() || !cand_out.is_open()) {
+        std::cout << "[LKH Error] Unable to open candidate files: " << task.pi_file << std::endl;
+        return;
+    }
+    pi_out << size << "\n";
+    cand_out << size << "\n";
+    for (int i = 0; i < size; ++i) {
+        pi_out << i + 1 << " " << candidates.pi[i] << "\n";
+        int count = 0;
+        while (count < width && candidates.to[i * width + count] >= 0) ++count;
+        cand_out << i + 1 << " 0 " << count;
+        for (int k = i * width; k < i * width + count; ++k) {
+            cand_out << " " << candidates.to[k] + 1 << " " << candidates.alpha[k];
+        }
+        cand_out << "\n";
+    }
+    pi_out << "-1\nEOF\n";
+    cand_out << "-1\nEOF\n";
+}
+
+bool LKH::readCandidates(Task& task, LKHCandidates& candidates) {
+    std::ifstream pi_in(task.pi_file);
+    std::ifstream cand_in(task.candidate_file);
+    int size = task.positions.size();
+    int width = candidates.width;
+    int dimension;
+    if (!(pi_in >> dimension) || dimension != size || !(cand_in >> dimension) || dimension != size) {
+        return false;
+    }
+    candidates.pi.assign(size, 0);
+    candidates.to.assign(size * width, -1);
+    candidates.alpha.assign(size * width, 0);
+    // edges of the initial tour are added with alpha 1 by LKH, they belong to this tour only
+    std::vector<int> suc(size, -1);
+    for (int i = 0; i < (int) task.tour.size(); ++i) {
+        suc[task.tour[i]] = task.tour[(i + 1) % task.tour.size()];
+    }
+    int id, pi, dad, count, to, alpha;
+    for (int i = 0; i < size; ++i) {
+        if (!(pi_in >> id >> pi) || id < 1 || id > size) return false;
+        candidates.pi[id - 1] = pi;
+    }
+    while (cand_in >> id && id != -1) {
+        if (id < 1 || id > size || !(cand_in >> dad >> count)) return false;
+        for (int k = 0, c = 0; k < count; ++k) {
+            if (!(cand_in >> to >> alpha) || to < 1 || to > size) return false;
+            if (alpha == 1 && (suc[id - 1] == to - 1 || suc[to - 1] == id - 1)) continue;
+            if (c < width) {
+                candidates.to[(id - 1) * width + c] = to - 1;
+                candidates.alpha[(id - 1) * width + c] = alpha;
+                ++c;
+            }
+        }
+    }
+    return true;
 }
@@ -0,0 +1,93 @@
+/**
+ * LKHCache.cpp
+ * created on : Oct 17 2026
+ **/
+
+#include "LocalSearch/LKHCache.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+LKHCache::LKHCache(double tolerance) : tolerance(tolerance) {}
+
+double LKHCache::diagonal(const std::vector<std::array<double, 2>> &positions) {
+    double min_x = positions[0][0], max_x = min_x, min_y = positions[0][1], max_y = min_y;
+    for (auto &p : positions) {
+        min_x = std::min(min_x, p[0]);
+        max_x = std::max(max_x, p[0]);
+        min_y = std::min(min_y, p[1]);
+        max_y = std::max(max_y, p[1]);
+    }
+    return std::hypot(max_x - min_x, max_y - min_y);
+}
+
+bool LKHCache::lookup(const Groups &groups, const std::vector<std::array<double, 2>> &positions,
+                      LKHCandidates &candidates) {
+    if (!enabled() || groups.size() <= 0) return false;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    int n = groups.size();
+    double max_drift = tolerance * diagonal(positions);
+    for (int i = 0; i < n; ++i) {
+        int target = groups.first(i);
+        if (target >= (int) entries.size() || !entries[target].valid
+            || std::hypot(positions[i][0] - entries[target].x, positions[i][1] - entries[target].y) > max_drift) {
+            ++misses;
+            return false;
+        }
+    }
+
+    // targets of the cached candidates may be merged into other nodes now
+    node_of.assign(entries.size(), -1);
+    for (int i = 0; i < n; ++i) {
+        for (int k = groups.start[i]; k < groups.start[i + 1]; ++k) {
+            if (groups.ids[k] < (int) node_of.size()) node_of[groups.ids[k]] = i;
+        }
+    }
+
+    int width = candidates.width;
+    candidates.given = true;
+    candidates.pi.resize(n);
+    candidates.to.assign(n * width, -1);
+    candidates.alpha.assign(n * width, 0);
+    for (int i = 0; i < n; ++i) {
+        const Entry &e = entries[groups.first(i)];
+        candidates.pi[i] = e.pi;
+        int k = i * width;
+        for (int c = 0; c < (int) e.to.size() && k < (i + 1) * width; ++c) {
+            int j = node_of[e.to[c]];
+            if (j < 0 || j == i || std::find(&candidates.to[i * width], &candidates.to[k], j) != &candidates.to[k]) continue;
+            candidates.to[k] = j;
+            candidates.alpha[k] = e.alpha[c];
+            ++k;
+        }
+    }
+    ++hits;
+    return true;
+}
+
+void LKHCache::store(const Groups &groups, const std::vector<std::array<double, 2>> &positions,
+                     const LKHCandidates &candidates) {
+    int n = groups.size();
+    if (!enabled() || (int) candidates.pi.size() != n) return;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // penalties of different ascents do not mix, keep only the latest problem
+    for (auto &e : entries) e.valid = false;
+    for (int i = 0; i < n; ++i) {
+        int target = groups.first(i);
+        if (target >= (int) entries.size()) entries.resize(target + 1);
+        Entry &e = entries[target];
+        e.valid = true;
+        e.x = positions[i][0];
+        e.y = positions[i][1];
+        e.pi = candidates.pi[i];
+        e.to.clear();
+        e.alpha.clear();
+        for (int k = i * candidates.width; k < (i + 1) * candidates.width; ++k) {
+            if (candidates.to[k] < 0) continue;
+            e.to.push_back(groups.first(candidates.to[k]));
+            e.alpha.push_back(candidates.alpha[k]);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * LKHController.cpp
+ * created on : Oct 17 2026
+ **/
+
+#include "LocalSearch/LKHController.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <algorithm>
+
+LKHController::LKHController(bool adaptive) : adaptive(adaptive) {
+    // level 2 is the former fixed setting
+    levels = {{{3, 1, 1}}, {{3, 1, 5}}, {{5, 1, 10}}, {{5, 1, 25}}, {{5, 2, 25}}};
+}
+
+LKHController::Decision LKHController::choose(int size, double change) {
+    if (!adaptive) return {2, levels[2].effort};
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (level < 0) {
+        level = size < 50 ? 0 : size < 200 ? 1 : size < 500 ? 2 : 3;
+        if (LOG) std::cout << "LKH effort : start at level " << level << " for " << size << " nodes" << std::endl;
+    }
+    // an offspring close to its parents needs fewer trials
+    LKHEffort effort = levels[level].effort;
+    double factor = std::min(1.0, change / LKH_EFFORT_CHANGE);
+    effort.max_trials = std::max(1, int(std::lround(effort.max_trials * factor)));
+    return {level, effort};
+}
+
+void LKHController::record(const Decision& decision, double gain, double seconds) {
+    if (!adaptive) return;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    double rate = std::max(0.0, gain) / std::max(seconds, 1e-6);
+    double& r = levels[decision.level].rate;
+    r = r < 0 ? rate : (1 - LKH_EFFORT_SMOOTH) * r + LKH_EFFORT_SMOOTH * rate;
+    if (decision.level != level || ++calls < LKH_EFFORT_WINDOW) return;
+    calls = 0;
+
+    // hill climbing on the gain per second, an untried neighbour is tried first
+    int best = level;
+    for (int l : {level + 1, level - 1}) {
+        if (l < 0 || l >= (int) levels.size()) continue;
+        if (levels[l].rate < 0) {
+            best = l;
+            break;
+        }
+        if (levels[l].rate > levels[best].rate) best = l;
+    }
+    if (LOG && best != level) {
+        std::cout << "LKH effort : level " << level << " -> " << best
+                  << " (gain/s " << levels[level].rate << " -> "
+                  << (levels[best].rate < 0 ? std::string("untried") : std::to_string(levels[best].rate))
+                  << ", MOVE_TYPE = " << levels[best].effort.move_type
+                  << ", RUNS = " << levels[best].effort.runs
+                  << ", MAX_TRIALS = " << levels[best].effort.max_trials << ")" << std::endl;
+    }
+    level = best;
+}
@@ -0,0 +1,79 @@
+/**
+ * LKHLib.cpp
+ * created on : Oct 17 2026
+ **/
+
+#include "LocalSearch/LKHLib.hpp"
+#include "LKHEmbed.h"
+
+std::mutex LKHLib::lkh_mutex;
+
+std::vector<int> LKHLib::solve(const std::vector<double> &xs, const std::vector<double> &ys, const std::vector<int> &tour,
+                               const LKHEffort &effort, LKHCandidates *candidates,
+                               const std::vector<std::pair<int, int>> &fixed, const LKHDisks *disks) const {
+    std::vector<int> result;
+    solve(xs, ys, tour, result, effort, candidates, fixed, disks);
+    return result;
+}
+
+void LKHLib::solve(const std::vector<double> &xs, const std::vector<double> &ys, const std::vector<int> &tour,
+                   std::vector<int> &result, const LKHEffort &effort, LKHCandidates *candidates,
+                   const std::vector<std::pair<int, int>> &fixed, const LKHDisks *disks) const {
+    int n = tour.size();
+    if (n < 4) {                   // nothing to improve, and LKH rejects dimension < 3
+        result.assign(tour.begin(), tour.end());
+        return;
+    }
+
+    LKHEmbedParameters params;
+    LKHEmbed_DefaultParameters(&params);
+    params.MoveType = effort.move_type;
+    params.Runs = effort.runs;
+    params.MaxTrials = effort.max_trials;
+    params.Seed = seed;
+    if (disks) {
+        params.DiskX = disks->x.data();
+        params.DiskY = disks->y.data();
+        params.DiskR = disks->r.data();
+        params.PointWeight = disks->point_weight;
+    }
+
+    LKHEmbedCandidates embed_candidates{0, 0, nullptr, nullptr, nullptr};
+    if (candidates) {
+        if (!candidates->given) {
+            candidates->pi.resize(n);
+            candidates->to.resize(n * candidates->width);
+            candidates->alpha.resize(n * candidates->width);
+        }
+        embed_candidates.Given = candidates->given;
+        embed_candidates.Width = candidates->width;
+        embed_candidates.Pi = candidates->pi.data();
+        embed_candidates.To = candidates->to.data();
+        embed_candidates.Alpha = candidates->alpha.data();
+    }
+
+    static thread_local std::vector<int> fixed_edges;     // reused, the calls of a thread are sequential
+    fixed_edges.clear();
+    for (auto &e : fixed) {
+        fixed_edges.push_back(e.first);
+        fixed_edges.push_back(e.second);
+    }
+
+    result.resize(n);
+    std::lock_guard<std::mutex> lock(lkh_mutex);
+    LKHEmbed_Solve(n, xs.data(), ys.data(), tour.data(), result.data(), &params, candidates ? &embed_candidates : nullptr,
+                   fixed.size(), fixed_edges.data());
+}
+
+void LKHLib::gpx(const std::vector<double> &xs, const std::vector<double> &ys, const std::vector<int> &tour_a,
+                 const std::vector<int> &tour_b, std::vector<int> &offspring) const {
+    int n = tour_a.size();
+    if (n < 4) {
+        offspring = tour_a;
+        return;
+    }
+
+    offspring.resize(n);
+    std::lock_guard<std::mutex> lock(lkh_mutex);
+    LKHEmbed_GPX(n, xs.data(), ys.data(), tour_a.data(), tour_b.data(), offspring.data());
+}
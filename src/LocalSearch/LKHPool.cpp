@@ -0,0 +1,265 @@
+/**
+ * LKHPool.cpp
+ * created on : Oct 17 2026
+ **/
+
+#include "LocalSearch/LKHPool.hpp"
+
+#include <iostream>
+#include <cstring>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <csignal>
+#include <chrono>
+#include <thread>
+#include <sys/wait.h>
+
+// the pipe ends must not leak into the workers forked later, else a worker never sees EOF once we close its stdin
+static int cloexecPipe(int fds[2]) {
+#ifdef __linux__
+    return pipe2(fds, O_CLOEXEC);
+#else
+    if (pipe(fds) != 0) return -1;
+    fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+    fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+    return 0;
+#endif
+}
+
+// true if the process exited within timeout_ms
+static bool waitExit(pid_t pid, int timeout_ms) {
+    for (int waited = 0; ; waited += 10) {
+        pid_t done = waitpid(pid, nullptr, WNOHANG);
+        if (done == pid || done < 0) return true;
+        if (waited >= timeout_ms) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+#endif
+
+LKHPool::~LKHPool() {
+    for (auto& w : workers) {
+        stop(w);
+    }
+}
+
+void LKHPool::start(std::string worker_exe, int size) {
+    this->worker_exe = worker_exe;
+#ifndef _WIN32
+    signal(SIGPIPE, SIG_IGN);           // a dead worker must not kill us, the write fails instead
+#endif
+    workers.resize(std::max(size, 1));
+    for (auto& w : workers) {
+        if (!spawn(w)) {
+            std::cerr << "[LKH Error] Unable to start LKH worker: " << worker_exe << std::endl;
+        }
+    }
+}
+
+bool LKHPool::spawn(Worker& w) {
+#ifdef _WIN32
+    SECURITY_ATTRIBUTES sa{sizeof(SECURITY_ATTRIBUTES), nullptr, TRUE};
+    HANDLE in_read, in_write, out_read, out_write;
+    if (!CreatePipe(&in_read, &in_write, &sa, 0)) return false;
+    if (!CreatePipe(&out_read, &out_write, &sa, 0)) {
+        CloseHandle(in_read);
+        CloseHandle(in_write);
+        return false;
+    }
+    SetHandleInformation(in_write, HANDLE_FLAG_INHERIT, 0);
+    SetHandleInformation(out_read, HANDLE_FLAG_INHERIT, 0);
+
+    STARTUPINFOA si;
+    PROCESS_INFORMATION pi;
+    ZeroMemory(&si, sizeof(si));
+    ZeroMemory(&pi, sizeof(pi));
+    si.cb = sizeof(si);
+    si.dwFlags = STARTF_USESTDHANDLES;
+    si.hStdInput = in_read;
+    si.hStdOutput = out_write;
+    si.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+    std::string cmd = "\"" + worker_exe + "\"";
+    BOOL ok = CreateProcessA(nullptr, cmd.data(), nullptr, nullptr, TRUE, CREATE_NO_WINDOW, nullptr, nullptr, &si, &pi);
+    CloseHandle(in_read);
+    CloseHandle(out_write);
+    if (!ok) {
+        CloseHandle(in_write);
+        CloseHandle(out_read);
+        return false;
+    }
+    CloseHandle(pi.hThread);
+    w.pid = (long long) pi.hProcess;
+    w.to = _fdopen(_open_osfhandle((intptr_t) in_write, _O_WRONLY), "w");
+    w.from = _fdopen(_open_osfhandle((intptr_t) out_read, _O_RDONLY), "r");
+#else
+    int to_worker[2], from_worker[2];
+    if (cloexecPipe(to_worker) != 0) return false;
+    if (cloexecPipe(from_worker) != 0) {
+        close(to_worker[0]);
+        close(to_worker[1]);
+        return false;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        dup2(to_worker[0], STDIN_FILENO);
+        dup2(from_worker[1], STDOUT_FILENO);
+        close(to_worker[0]);
+        close(to_worker[1]);
+        close(from_worker[0]);
+        close(from_worker[1]);
+        execl(worker_exe.c_str(), worker_exe.c_str(), (char*) nullptr);
+        _exit(127);
+    }
+    close(to_worker[0]);
+    close(from_worker[1]);
+    if (pid < 0) {
+        close(to_worker[1]);
+        close(from_worker[0]);
+        return false;
+    }
+    w.pid = pid;
+    w.to = fdopen(to_worker[1], "w");
+    w.from = fdopen(from_worker[0], "r");
+#endif
+    return w.to != nullptr && w.from != nullptr;
+}
+
+void LKHPool::stop(Worker& w) {
+    if (w.to) {
+        std::fputs("QUIT\n", w.to);
+        std::fclose(w.to);
+        w.to = nullptr;
+    }
+    if (w.from) {
+        std::fclose(w.from);
+        w.from = nullptr;
+    }
+    if (w.pid) {
+#ifdef _WIN32
+        HANDLE process = (HANDLE) w.pid;
+        if (WaitForSingleObject(process, 1000) == WAIT_TIMEOUT) {
+            TerminateProcess(process, 1);
+        }
+        CloseHandle(process);
+#else
+        // same grace period as on Windows for the QUIT, then a hung worker is terminated
+        pid_t pid = (pid_t) w.pid;
+        if (!waitExit(pid, 1000)) {
+            kill(pid, SIGTERM);
+            if (!waitExit(pid, 1000)) {
+                kill(pid, SIGKILL);
+                waitpid(pid, nullptr, 0);
+            }
+        }
+#endif
+        w.pid = 0;
+    }
+}
+
+std::vector<int> LKHPool::solve(const std::vector<double> &xs, const std::vector<double> &ys, const std::vector<int> &tour,
+                                const LKHEffort &effort, LKHCandidates *candidates,
+                                const std::vector<std::pair<int, int>> &fixed, const LKHDisks *disks) {
+    int n = tour.size();
+    if (n < 4 || workers.empty()) return tour;
+
+    Worker* w = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        idle.wait(lock, [this] {
+            for (auto& v : workers) if (!v.busy) return true;
+            return false;
+        });
+        for (auto& v : workers) {
+            if (!v.busy) {
+                w = &v;
+                break;
+            }
+        }
+        w->busy = true;
+    }
+
+    std::vector<int> result(n);
+    int mode = candidates == nullptr ? 0 : candidates->given ? 1 : 2;
+    bool ok = w->to != nullptr && w->from != nullptr;
+    if (ok) {
+        std::fprintf(w->to, "SOLVE %d %d %d %d %u %d %d %d\n", n, effort.move_type, effort.runs, effort.max_trials, seed,
+                     mode, (int) fixed.size(), disks ? 1 : 0);
+        for (int i = 0; i < n; ++i) {
+            std::fprintf(w->to, "%.17g %.17g\n", xs[i], ys[i]);
+        }
+        for (int i = 0; i < n; ++i) {
+            std::fprintf(w->to, i + 1 < n ? "%d " : "%d\n", tour[i]);
+        }
+        if (mode == 1) {
+            int width = candidates->width;
+            std::fprintf(w->to, "%d\n", width);
+            for (int i = 0; i < n; ++i) {
+                std::fprintf(w->to, "%d", candidates->pi[i]);
+                for (int k = i * width; k < (i + 1) * width; ++k) {
+                    std::fprintf(w->to, " %d %d", candidates->to[k], candidates->alpha[k]);
+                }
+                std::fputc('\n', w->to);
+            }
+        }
+        for (auto &e : fixed) {
+            std::fprintf(w->to, "%d %d\n", e.first, e.second);
+        }
+        if (disks) {
+            std::fprintf(w->to, "%.17g\n", disks->point_weight);
+            for (int i = 0; i < n; ++i) {
+                std::fprintf(w->to, "%.17g %.17g %.17g\n", disks->x[i], disks->y[i], disks->r[i]);
+            }
+        }
+        ok = std::fflush(w->to) == 0;
+    }
+    if (ok) {
+        char header[16];
+        int dimension;
+        long long cost;
+        ok = std::fscanf(w->from, "%15s %d %lld", header, &dimension, &cost) == 3
+             && std::strcmp(header, "TOUR") == 0 && dimension == n;
+        for (int i = 0; ok && i < n; ++i) {
+            ok = std::fscanf(w->from, "%d", &result[i]) == 1;
+        }
+    }
+    if (ok && mode == 2) {
+        int width;
+        ok = std::fscanf(w->from, "%d", &width) == 1 && width >= 0;
+        if (ok) {
+            candidates->width = width;
+            candidates->pi.resize(n);
+            candidates->to.resize(n * width);
+            candidates->alpha.resize(n * width);
+        }
+        for (int i = 0; ok && i < n; ++i) {
+            ok = std::fscanf(w->from, "%d", &candidates->pi[i]) == 1;
+            for (int k = i * width; ok && k < (i + 1) * width; ++k) {
+                ok = std::fscanf(w->from, "%d %d", &candidates->to[k], &candidates->alpha[k]) == 2;
+            }
+        }
+    }
+    if (!ok) {
+        // the worker died or answered garbage, replace it and keep the input tour
+        std::cerr << "[LKH Error] LKH worker failed, restarting it" << std::endl;
+        stop(*w);
+        if (!spawn(*w)) {
+            std::cerr << "[LKH Error] Unable to start LKH worker: " << worker_exe << std::endl;
+        }
+        result = tour;
+        if (candidates) candidates->pi.clear();     // nothing computed
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        w->busy = false;
+    }
+    idle.notify_one();
+    return result;
+}
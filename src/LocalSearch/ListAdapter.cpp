@@ -12,20 +12,32 @@ ListAdapter::~ListAdapter() {}
 List* ListAdapter::real2Reduced(List* real_list) {
     // real_list->print();
     int size = real_list->size();
+    groups.start.clear();
+    groups.ids.clear();
+    xs.clear();
+    ys.clear();
+    merged.clear();
     Node* p = real_list->head();
     for (int i = 0; i < size; ++i) {
         double x = p->x, y = p->y;
+        groups.ids.emplace_back(p->id);
         if (i == 0 || !(x == p->pre->x && y == p->pre->y)) {
-            nodes.emplace_back(std::vector<int> {p->id});
-            positions.emplace_back(std::vector<double> {x, y});
+            groups.start.emplace_back(groups.ids.size() - 1);
+            xs.emplace_back(x);
+            ys.emplace_back(y);
+            merged.emplace_back(nullptr);
             p = p->next;
         } else {
-            nodes[nodes.size() - 1].emplace_back(p->id);
+            // unlink redundant nodes, they are linked back by reduced2Real
+            Node* node = p;
             p = p->next;
-            // delete redundant nodes
-            real_list->remove(p->pre);
+            node->pre->next = p;
+            p->pre = node->pre;
+            merged.emplace_back(node);
+            real_list->setSize(real_list->size() - 1);
         }
     }
+    groups.start.emplace_back(groups.ids.size());
 
     // update id
     p = real_list->head();
@@ -47,12 +59,27 @@ List* ListAdapter::reduced2Real(List* reduced_list) {
     for (int i = 0; i < size; ++i) {
         int index = p->id;
         Node* next = p->next;
-        p->id = nodes[index][0];
-        for (int j = 1; j < nodes[index].size(); ++j) {
-            reduced_list->add(new Node(nodes[index][j], positions[index][0], positions[index][1]), p);
+        p->id = groups.first(index);
+        Node* pos = p;
+        for (int k = groups.start[index] + 1; k < groups.start[index + 1]; ++k) {
+            Node* node = merged[k];
+            node->x = xs[index];
+            node->y = ys[index];
+            reduced_list->add(node, pos);
+            pos = node;
         }
         p = next;
     }
     // reduced_list->print();
     return reduced_list;
-}
\ No newline at end of file
+}
+
+void ListAdapter::identity(int size) {
+    groups.start.resize(size + 1);
+    groups.ids.resize(size);
+    for (int i = 0; i < size; ++i) {
+        groups.start[i] = i;
+        groups.ids[i] = i;
+    }
+    groups.start[size] = size;
+}
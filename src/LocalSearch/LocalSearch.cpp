@@ -10,9 +10,17 @@
 //     this->improvement = improvement;
 // }
 
-LocalSearch::LocalSearch(Parameters *params) : greed(params->greed) {
+LocalSearch::LocalSearch(Parameters *params) : lkh(params->lkh_backend, params->lkh_workers, params->lkh_cache_tol, params->lkh_fix,
+                                                   params->lkh_adaptive, params->lkh_cost, params->lkh_point_weight), greed(params->greed),
+                                               solver(params->solver, params->solver_gap, params->solver_incremental,
+                                                      params->solver_active, params->solver_threads) {
     this->lkh_random_num = params->random_num;
     this->improvement = params->improvement;
+    this->seq_opt = params->seq_opt;
+    if (seq_opt != "LKH" && seq_opt != "NATIVE" && seq_opt != "AUTO") {
+        std::cerr << "[ERROR] unknown sequence optimizer " << seq_opt << ", LKH is used" << std::endl;
+        this->seq_opt = "LKH";
+    }
 }
 
 LocalSearch::~LocalSearch() {}
@@ -25,7 +33,7 @@ void LocalSearch::setContext(Random *random, Centers &centers, Neighbor* neighbo
     if (lkh_random_num == 0) {
         lkh_random_num = random->randomInt(INT_MAX);
     }
-    lkh.setContext(timestamp, lkh_random_num);
+    lkh.setContext(timestamp, lkh_random_num, centers);
     greed.setContext(centers);
 }
 
@@ -36,19 +44,40 @@ List *LocalSearch::initSolOpt(List *s) {
 }
 
 
-List *LocalSearch::VND(List *s) {
+List *LocalSearch::VND(List *s, List *parent1, List *parent2, bool exact) {
     s->evaluate();
     if (LOG) std::cout << "offspring solution : " << s->getValue() << std::endl;
     greed.run(s);
-    s = lkh.run(s, true);
+    bool native = seq_opt == "NATIVE";
+    if (seq_opt == "AUTO" && parent1 != nullptr && parent2 != nullptr) {
+        native = SequenceOpt::newEdges(s, parent1, parent2) <= SEQ_OPT_CHANGE;
+    }
+    if (native) s = sequence.run(s, neighbor->getNeighborLists());
+    else s = lkh.run(s, true, parent1, parent2);
     greed.run(s);
     jointOpt(s);
-    solver.solve(s);
+    if (exact) solver.solve(s);
     return s;
 }
 
+double LocalSearch::solve(List *s, double tolerance) {
+    return solver.solve(s, tolerance);
+}
+
+void LocalSearch::solveBatch(const std::vector<List*>& solutions) {
+    solver.solveBatch(solutions);
+}
+
+void LocalSearch::solveExact(List *s) {
+    solver.solveExact(s);
+}
+
+double LocalSearch::lowerBound(List *s, double cutoff) {
+    return solver.lowerBound(s, cutoff);
+}
+
 void LocalSearch::jointOpt(List* s) {
-    this->neighbors = this->neighbor->getNeighbors();
+    this->neighbors = &this->neighbor->getNeighbors();
     auto start = std::chrono::high_resolution_clock::now();
     if (improvement == "FIRST") {
         firstImproveApproxRelocate(s);
@@ -68,7 +97,7 @@ void LocalSearch::randomTwoOpt(List* s) {
     auto start = std::chrono::high_resolution_clock::now();
     // first-improvement 2-opt with random order
     int size = s->size();
-    std::vector<Node*> nodes(size);
+    nodes.resize(size);
     Node* p = s->head();
     for (int i = 0; i < size; ++i) {
         nodes[i] = p;
@@ -108,7 +137,7 @@ void LocalSearch::randomTwoOpt(List* s) {
 
 void LocalSearch::bestImproveApproxRelocate(List *s) {
     int size = s->size();
-    std::vector<Node*> nodes(size);
+    nodes.resize(size);
     Node* p = s->head();
     for (int i = 0; i < size; ++i) {
         nodes[i] = p;
@@ -127,7 +156,7 @@ void LocalSearch::bestImproveApproxRelocate(List *s) {
             bool best_is_in_line = true;
             for (int j = 0; j < nodes.size(); ++j) {
                 if (i == j || nodes[i] == nodes[j]->next) continue;
-                if (!neighbors[nodes[i]->id][nodes[j]->id]) continue;        // neighbors or global
+                if (!(*neighbors)[nodes[i]->id][nodes[j]->id]) continue;        // neighbors or global
                 // move nodes[i] after nodes[j]
                 double delta = 0;
                 double approx_point_x = 0, approx_point_y = 0;
@@ -138,12 +167,13 @@ void LocalSearch::bestImproveApproxRelocate(List *s) {
                 } else {
                     double mid_point_x = (nodes[j]->x + nodes[j]->next->x) / 2;
                     double mid_point_y = (nodes[j]->y + nodes[j]->next->y) / 2;
-                    auto intersections = Geometry::solveLineIntersectSphere(mid_point_x, mid_point_y, centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][2]);
-                    if (intersections.size() != 1) {
-                        std::cout << "ERROR : " << intersections.size() << " intersections" << std::endl;
+                    double ix[2], iy[2];
+                    int count = Geometry::lineIntersectSphere(mid_point_x, mid_point_y, centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][2], ix, iy);
+                    if (count != 1) {
+                        std::cout << "ERROR : " << count << " intersections" << std::endl;
                     }
-                    approx_point_x = intersections[0][0];
-                    approx_point_y = intersections[0][1];
+                    approx_point_x = ix[0];
+                    approx_point_y = iy[0];
                     delta = Node::distance(nodes[i]->pre, nodes[i]->next) - Node::distance(nodes[i], nodes[i]->pre) - Node::distance(nodes[i], nodes[i]->next)
                             + Geometry::EucDistance(approx_point_x, approx_point_y, nodes[j]->x, nodes[j]->y) + Geometry::EucDistance(approx_point_x, approx_point_y, nodes[j]->next->x, nodes[j]->next->y)
                             - Node::distance(nodes[j], nodes[j]->next);
@@ -186,7 +216,7 @@ void LocalSearch::bestImproveApproxRelocate(List *s) {
 
 void LocalSearch::bestImproveApproxSwap(List* s) {
     int size = s->size();
-    std::vector<Node*> nodes(size);
+    nodes.resize(size);
     Node* p = s->head();
     for (int i = 0; i < size; ++i) {
         nodes[i] = p;
@@ -205,11 +235,12 @@ void LocalSearch::bestImproveApproxSwap(List* s) {
 
             for (int j = i + 1; j < size; ++j) {
                 if (nodes[j]->id == 0 || nodes[i]->next == nodes[j] || nodes[j]->next == nodes[i]) continue;
-                if (!neighbors[nodes[i]->id][nodes[j]->id]) continue;
+                if (!(*neighbors)[nodes[i]->id][nodes[j]->id]) continue;
                 // swap nodes[i] and nodes[j]
 
-                auto posi = greed.approxPosition(centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][2], nodes[j]->pre, nodes[j]->next);
-                auto posj = greed.approxPosition(centers[nodes[j]->id][0], centers[nodes[j]->id][1], centers[nodes[j]->id][2], nodes[i]->pre, nodes[i]->next);
+                double posi[2], posj[2];
+                greed.approxPosition(centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][2], nodes[j]->pre, nodes[j]->next, posi[0], posi[1]);
+                greed.approxPosition(centers[nodes[j]->id][0], centers[nodes[j]->id][1], centers[nodes[j]->id][2], nodes[i]->pre, nodes[i]->next, posj[0], posj[1]);
 
                 double delta = Geometry::EucDistance(posi[0], posi[1], nodes[j]->pre->x, nodes[j]->pre->y) + Geometry::EucDistance(posi[0], posi[1], nodes[j]->next->x, nodes[j]->next->y)
                                + Geometry::EucDistance(posj[0], posj[1], nodes[i]->pre->x, nodes[i]->pre->y) + Geometry::EucDistance(posj[0], posj[1], nodes[i]->next->x, nodes[i]->next->y)
@@ -253,7 +284,7 @@ void LocalSearch::bestImproveApproxSwap(List* s) {
 
 void LocalSearch::firstImproveApproxRelocate(List* s) {
     int size = s->size();
-    std::vector<Node*> nodes(size);
+    nodes.resize(size);
     Node* p = s->head();
     for (int i = 0; i < size; ++i) {
         nodes[i] = p;
@@ -268,7 +299,7 @@ void LocalSearch::firstImproveApproxRelocate(List* s) {
             if (nodes[i]->id == 0) continue;
             for (int j = 0; j < size; ++j) {
                 if (i == j || nodes[i] == nodes[j]->next) continue;
-                if (!neighbors[nodes[i]->id][nodes[j]->id]) continue;        // neighbors or global
+                if (!(*neighbors)[nodes[i]->id][nodes[j]->id]) continue;        // neighbors or global
                 // move nodes[i] after nodes[j]
                 double delta;
                 double approx_point_x ,approx_point_y;
@@ -278,12 +309,13 @@ void LocalSearch::firstImproveApproxRelocate(List* s) {
                 } else {
                     double mid_point_x = (nodes[j]->x + nodes[j]->next->x) / 2;
                     double mid_point_y = (nodes[j]->y + nodes[j]->next->y) / 2;
-                    auto intersections = Geometry::solveLineIntersectSphere(mid_point_x, mid_point_y, centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][2]);
-                    if (intersections.size() != 1) {
-                        std::cout << "ERROR : " << intersections.size() << " intersections" << std::endl;
+                    double ix[2], iy[2];
+                    int count = Geometry::lineIntersectSphere(mid_point_x, mid_point_y, centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][2], ix, iy);
+                    if (count != 1) {
+                        std::cout << "ERROR : " << count << " intersections" << std::endl;
                     }
-                    approx_point_x = intersections[0][0];
-                    approx_point_y = intersections[0][1];
+                    approx_point_x = ix[0];
+                    approx_point_y = iy[0];
                     delta = Node::distance(nodes[i]->pre, nodes[i]->next) - Node::distance(nodes[i], nodes[i]->pre) - Node::distance(nodes[i], nodes[i]->next)
                             + Geometry::EucDistance(approx_point_x, approx_point_y, nodes[j]->x, nodes[j]->y) + Geometry::EucDistance(approx_point_x, approx_point_y, nodes[j]->next->x, nodes[j]->next->y)
                             - Node::distance(nodes[j], nodes[j]->next);
@@ -320,7 +352,7 @@ void LocalSearch::firstImproveApproxRelocate(List* s) {
 
 void LocalSearch::firstImproveApproxSwap(List* s) {
     int size = s->size();
-    std::vector<Node*> nodes(size);
+    nodes.resize(size);
     Node* p = s->head();
     for (int i = 0; i < size; ++i) {
         nodes[i] = p;
@@ -336,9 +368,10 @@ void LocalSearch::firstImproveApproxSwap(List* s) {
                 if (nodes[j]->id == 0) continue;
                 // swap nodes[i] and nodes[j]
                 if (nodes[i]->next == nodes[j] || nodes[j]->next == nodes[i]) continue;
-                if (!neighbors[nodes[i]->id][nodes[j]->id]) continue;
-                auto posi = greed.approxPosition(centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][2], nodes[j]->pre, nodes[j]->next);
-                auto posj = greed.approxPosition(centers[nodes[j]->id][0], centers[nodes[j]->id][1], centers[nodes[j]->id][2], nodes[i]->pre, nodes[i]->next);
+                if (!(*neighbors)[nodes[i]->id][nodes[j]->id]) continue;
+                double posi[2], posj[2];
+                greed.approxPosition(centers[nodes[i]->id][0], centers[nodes[i]->id][1], centers[nodes[i]->id][2], nodes[j]->pre, nodes[j]->next, posi[0], posi[1]);
+                greed.approxPosition(centers[nodes[j]->id][0], centers[nodes[j]->id][1], centers[nodes[j]->id][2], nodes[i]->pre, nodes[i]->next, posj[0], posj[1]);
                 double delta = Geometry::EucDistance(posi[0], posi[1], nodes[j]->pre->x, nodes[j]->pre->y) + Geometry::EucDistance(posi[0], posi[1], nodes[j]->next->x, nodes[j]->next->y)
                         + Geometry::EucDistance(posj[0], posj[1], nodes[i]->pre->x, nodes[i]->pre->y) + Geometry::EucDistance(posj[0], posj[1], nodes[i]->next->x, nodes[i]->next->y)
                         - Node::distance(nodes[i], nodes[i]->pre) - Node::distance(nodes[i], nodes[i]->next)
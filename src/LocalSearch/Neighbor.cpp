@@ -39,10 +39,22 @@ void Neighbor::updateNeighbors() {
         }
     }
     neighbors.resize(size, std::vector<int> (size, 0));
+    lists.resize(size);
+    order.resize(size);
     for (int i = 0; i < size; ++i) {
-        std::vector<double> distance = distances[i];
-        std::sort(distance.begin(), distance.end());
-        double threshold = distance[neighbor_size-1];
+        std::iota(order.begin(), order.end(), 0);
+        int k = std::min(neighbor_size + 1, size);
+        std::partial_sort(order.begin(), order.begin() + k, order.end(),
+                          [&](int a, int b) { return distances[i][a] < distances[i][b]; });
+        lists[i].clear();
+        for (int j = 0; j < k; ++j) {
+            if (order[j] != i && (int) lists[i].size() < neighbor_size) lists[i].emplace_back(order[j]);
+        }
+    }
+    for (int i = 0; i < size; ++i) {
+        sorted.assign(distances[i].begin(), distances[i].end());
+        std::nth_element(sorted.begin(), sorted.begin() + neighbor_size - 1, sorted.end());
+        double threshold = sorted[neighbor_size-1];
         for (int j = 0; j < size; ++j) {
             if (distances[i][j] > 0 && distances[i][j] <= threshold) {
                 neighbors[i][j] = 1;
@@ -52,10 +64,6 @@ void Neighbor::updateNeighbors() {
     }
 }
 
-std::vector<std::vector<int>> Neighbor::getNeighbors() {
-    return neighbors;
-}
-
 std::vector<std::vector<double>> Neighbor::getCentroids() {
     return centroids;
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+/**
+ * RubberBand.cpp
+ * created on : Oct 17 2026
+ **/
+
+#include "LocalSearch/RubberBand.hpp"
+#include <cmath>
+
+typedef std::vector<double> Vec;
+
+RubberBand::RubberBand() : n(0) {}
+RubberBand::~RubberBand() {}
+
+double RubberBand::length(const Vec& x, const Vec& y) const {
+    double value = 0;
+    for (int i = 0; i < n; ++i) {
+        int j = i + 1 == n ? 0 : i + 1;
+        value += std::sqrt((x[i] - x[j]) * (x[i] - x[j]) + (y[i] - y[j]) * (y[i] - y[j]));
+    }
+    return value;
+}
+
+double RubberBand::bound(const double* cx, const double* cy, const double* r) const {
+    double value = 0;
+    for (int i = 0; i < n; ++i) {
+        int h = i == 0 ? n - 1 : i - 1;
+        double gx = ux[i] - ux[h], gy = uy[i] - uy[h];
+        value += cx[i] * gx + cy[i] * gy - r[i] * std::sqrt(gx * gx + gy * gy);
+    }
+    return value;
+}
+
+RubberBand::Result RubberBand::solve(int n, const double* cx, const double* cy, const double* r, Vec& x, Vec& y,
+                                     double gap, int max_iterations, double cutoff) {
+    this->n = n;
+    auto project = [&](int i) {
+        double qx = x[i] - cx[i], qy = y[i] - cy[i];
+        double q = qx * qx + qy * qy;
+        if (q > r[i] * r[i]) {
+            double scale = r[i] / std::sqrt(q);
+            x[i] = cx[i] + scale * qx, y[i] = cy[i] + scale * qy;
+        }
+    };
+    for (int i = 0; i < n; ++i) project(i);
+    Result result = {length(x, y), 0, 0};
+    if (n < 2) return result;
+
+    // the dual starts from the directions of the edges, which is optimal for the optimal points
+    ux.resize(n), uy.resize(n);
+    for (int i = 0; i < n; ++i) {
+        int j = i + 1 == n ? 0 : i + 1;
+        double dx = x[i] - x[j], dy = y[i] - y[j];
+        double d = std::sqrt(dx * dx + dy * dy);
+        ux[i] = d > 0 ? dx / d : 0;
+        uy[i] = d > 0 ? dy / d : 0;
+    }
+    px.assign(x.begin(), x.end());
+    py.assign(y.begin(), y.end());
+    bx.assign(x.begin(), x.end());
+    by.assign(y.begin(), y.end());
+    double best = result.value;
+    double lower = bound(cx, cy, r);
+
+    // the difference operator has norm at most 2, so sigma * tau * 4 < 1
+    double scale = SOLVER_BAND_STEP * std::max(best, 1e-12) / n;
+    double sigma = 1 / scale, tau = 0.99 * scale / 4;
+    int k = 0;
+    auto decided = [&]() { return std::isfinite(cutoff) && (lower >= cutoff || best < cutoff); };
+    while (best - lower > gap * best && k < max_iterations && !decided()) {
+        ++k;
+        for (int i = 0; i < n; ++i) {
+            int j = i + 1 == n ? 0 : i + 1;
+            // extrapolated points 2 x - px
+            ux[i] += sigma * ((2 * x[i] - px[i]) - (2 * x[j] - px[j]));
+            uy[i] += sigma * ((2 * y[i] - py[i]) - (2 * y[j] - py[j]));
+            double u = ux[i] * ux[i] + uy[i] * uy[i];
+            if (u > 1) {
+                u = std::sqrt(u);
+                ux[i] /= u, uy[i] /= u;
+            }
+        }
+        px.swap(x);
+        py.swap(y);
+        for (int i = 0; i < n; ++i) {
+            int h = i == 0 ? n - 1 : i - 1;
+            x[i] = px[i] - tau * (ux[i] - ux[h]);
+            y[i] = py[i] - tau * (uy[i] - uy[h]);
+            project(i);
+        }
+        if (k % SOLVER_BAND_CHECK == 0 || k == max_iterations) {
+            double value = length(x, y);
+            if (value < best) {
+                best = value;
+                bx.assign(x.begin(), x.end());
+                by.assign(y.begin(), y.end());
+            }
+            lower = std::max(lower, bound(cx, cy, r));
+        }
+    }
+    x.assign(bx.begin(), bx.end());
+    y.assign(by.begin(), by.end());
+    result.value = best;
+    result.gap = (best - lower) / std::max(best, 1e-12);
+    result.iterations = k;
+    return result;
+}
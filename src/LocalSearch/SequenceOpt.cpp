@@ -0,0 +1,204 @@
+/**
+ * SequenceOpt.cpp
+ * created on : Oct 17 2026
+ **/
+
+#include "LocalSearch/SequenceOpt.hpp"
+#include <chrono>
+#include <algorithm>
+
+SequenceOpt::SequenceOpt(int two_level_size) : size(0), two_level_size(two_level_size) {}
+SequenceOpt::~SequenceOpt() {}
+
+List* SequenceOpt::run(List* solution, const std::vector<std::vector<int>>& lists) {
+    auto start = std::chrono::high_resolution_clock::now();
+    if ((int) lists.size() < solution->size()) {
+        std::cerr << "[SequenceOpt Warning] neighbor lists are not built, the solution is kept" << std::endl;
+        return solution;
+    }
+    solution = la.real2Reduced(solution);
+    size = solution->size();
+    if (size >= 5) {
+        // reduced ids are the positions in the reduced list
+        nodes.resize(size);
+        order.resize(size);
+        pos.resize(size);
+        Node* p = solution->head();
+        for (int i = 0; i < size; ++i) {
+            nodes[i] = p;
+            order[i] = i;
+            pos[i] = i;
+            p = p->next;
+        }
+        buildCandidates(la.getGroups(), lists);
+        two_level = size >= two_level_size;
+        if (two_level) list.init(order);
+
+        active.assign(size, 0);
+        queue.clear();
+        for (int i = 0; i < size; ++i) push(i);
+        while (!queue.empty()) {
+            int t = queue.front();
+            queue.pop_front();
+            active[t] = 0;
+            double gain = twoOpt(t);
+            if (gain <= 0) gain = orOpt(t);
+            if (gain > 0) push(t);
+        }
+
+        // relink in array order, the head is kept
+        if (two_level) list.tour(order);
+        for (int i = 0; i < size; ++i) {
+            Node* a = nodes[order[i]];
+            Node* b = nodes[order[i + 1 == size ? 0 : i + 1]];
+            a->next = b;
+            b->pre = a;
+        }
+    }
+    solution = la.reduced2Real(solution);
+    solution->evaluate();
+    auto end = std::chrono::high_resolution_clock::now();
+    if (LOG) std::cout << "sequence solution : " << solution->getValue() << " time : " << std::chrono::duration<double> (end - start).count() << " s" << std::endl;
+    return solution;
+}
+
+void SequenceOpt::buildCandidates(const Groups& groups, const std::vector<std::vector<int>>& lists) {
+    reduced.resize(groups.ids.size());
+    for (int i = 0; i < size; ++i) {
+        for (int k = groups.start[i]; k < groups.start[i + 1]; ++k) reduced[groups.ids[k]] = i;
+    }
+    stamp.assign(size, -1);
+    cand_start.resize(size + 1);
+    cand.clear();
+    for (int i = 0; i < size; ++i) {
+        cand_start[i] = cand.size();
+        stamp[i] = i;
+        // nodes at the same point are merged, so take the nearest neighbors until enough reduced nodes are found
+        for (int k = groups.start[i]; k < groups.start[i + 1]; ++k) {
+            const std::vector<int>& list = lists[groups.ids[k]];
+            for (int j = 0, found = 0; j < (int) list.size() && found < SEQ_OPT_NEIGHBORS; ++j) {
+                int r = reduced[list[j]];
+                if (stamp[r] == i) continue;
+                stamp[r] = i;
+                cand.emplace_back(r);
+                ++found;
+            }
+        }
+        // nearest in the current tour first, so that 2-opt can stop early
+        std::sort(cand.begin() + cand_start[i], cand.end(), [&](int a, int b) { return dist(i, a) < dist(i, b); });
+    }
+    cand_start[size] = cand.size();
+}
+
+void SequenceOpt::push(int a) {
+    if (active[a]) return;
+    active[a] = 1;
+    queue.emplace_back(a);
+}
+
+void SequenceOpt::reverse(int i, int len) {
+    for (int k = 0; k < len / 2; ++k) {
+        int x = (i + k) % size, y = (i + len - 1 - k) % size;
+        std::swap(order[x], order[y]);
+        pos[order[x]] = x;
+        pos[order[y]] = y;
+    }
+}
+
+void SequenceOpt::reversePath(int a, int b) {
+    if (two_level) {
+        list.reverse(a, b);
+        return;
+    }
+    int len = (pos[b] - pos[a] + size) % size + 1;
+    if (2 * len > size) reverse((pos[b] + 1) % size, size - len);
+    else reverse(pos[a], len);
+}
+
+void SequenceOpt::move(int t1, int t2, int t3, int t4) {
+    // the edges stay the same
+    if (t2 == t3 || t1 == t4) return;
+    if (t2 == succ(t1)) reversePath(t2, t3);
+    else reversePath(t1, t4);
+}
+
+double SequenceOpt::twoOpt(int t1) {
+    for (int dir = 0; dir < 2; ++dir) {
+        int t2 = dir == 0 ? succ(t1) : pred(t1);
+        double d12 = dist(t1, t2);
+        for (int k = cand_start[t1]; k < cand_start[t1 + 1]; ++k) {
+            int t3 = cand[k];
+            double g1 = d12 - dist(t1, t3);
+            if (g1 <= EPSILON) break;
+            int t4 = dir == 0 ? succ(t3) : pred(t3);
+            if (t3 == t2 || t4 == t1) continue;
+            double gain = g1 + dist(t3, t4) - dist(t2, t4);
+            if (gain > EPSILON) {
+                move(t1, t2, t3, t4);
+                push(t1), push(t2), push(t3), push(t4);
+                return gain;
+            }
+        }
+    }
+    return 0;
+}
+
+double SequenceOpt::orOpt(int t1) {
+    int segment[3];
+    for (int len = 1; len <= 3 && len + 3 <= size; ++len) {
+        for (int side = 0; side < 2; ++side) {
+            if (len == 1 && side == 1) continue;
+            // segment s1 .. se of len nodes, with t1 at one end
+            segment[0] = t1;
+            for (int k = 1; side == 1 && k < len; ++k) segment[0] = pred(segment[0]);
+            for (int k = 1; k < len; ++k) segment[k] = succ(segment[k - 1]);
+            int s1 = segment[0], se = segment[len - 1];
+            int p = pred(s1), nx = succ(se);
+            auto inside = [&](int a) { return std::find(segment, segment + len, a) != segment + len; };
+            double removed = dist(p, s1) + dist(se, nx) - dist(p, nx);
+            if (removed <= EPSILON) continue;
+            for (int k = cand_start[t1]; k < cand_start[t1 + 1]; ++k) {
+                int c = cand[k];
+                if (inside(c)) continue;
+                for (int e = 0; e < 2; ++e) {
+                    // insert between a and b = succ(a), with t1 next to c
+                    int a = e == 0 ? c : pred(c);
+                    int b = e == 0 ? succ(c) : c;
+                    if (inside(a) || inside(b)) continue;
+                    bool forward = (c == a) == (t1 == s1);
+                    int first = forward ? s1 : se, last = forward ? se : s1;
+                    double gain = removed - dist(a, first) - dist(last, b) + dist(a, b);
+                    if (gain <= EPSILON) continue;
+
+                    // the tour is p S nx .. a b .. p, three 2-opt moves put S between a and b:
+                    // p a .. nx se .. s1 b, then p nx .. a se .. s1 b, then a s1 .. se b if s1 goes next to a
+                    move(p, s1, a, b);
+                    move(p, a, nx, se);
+                    if (forward) move(a, se, s1, b);
+                    push(p), push(nx), push(s1), push(se), push(a), push(b);
+                    return gain;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+double SequenceOpt::newEdges(List* offspring, List* parent1, List* parent2) {
+    static thread_local std::vector<int> next1, next2;
+    int size = offspring->size();
+    if (size == 0) return 0;
+    next1.assign(size, -1);
+    next2.assign(size, -1);
+    Node* p = parent1->head();
+    for (int i = 0; i < parent1->size(); ++i, p = p->next) next1[p->id] = p->next->id;
+    p = parent2->head();
+    for (int i = 0; i < parent2->size(); ++i, p = p->next) next2[p->id] = p->next->id;
+    int count = 0;
+    p = offspring->head();
+    for (int i = 0; i < size; ++i, p = p->next) {
+        int a = p->id, b = p->next->id;
+        if (next1[a] != b && next1[b] != a && next2[a] != b && next2[b] != a) ++count;
+    }
+    return (double) count / size;
+}
@@ -0,0 +1,215 @@
+/**
+ * SocpIPM.cpp
+ * created on : Oct 17 2026
+ **/
+
+#include "LocalSearch/SocpIPM.hpp"
+#include <cmath>
+
+typedef std::vector<double> Vec;
+
+SocpIPM::SocpIPM() : n(0), mu(0), cx(nullptr), cy(nullptr), r(nullptr) {}
+SocpIPM::~SocpIPM() {}
+
+double SocpIPM::solve(int n, const double* cx, const double* cy, const double* r, Vec& x, Vec& y, double tolerance) {
+    this->n = n;
+    this->cx = cx, this->cy = cy, this->r = r;
+    iterations = 0;
+    gap = 0;
+    fixed.assign(n, 0);
+    int barriers = n;                               // one cone per edge and per free disk
+    for (int i = 0; i < n; ++i) {
+        if (r[i] <= SOLVER_MIN_RADIUS) {
+            fixed[i] = 1;
+            x[i] = cx[i], y[i] = cy[i];
+            continue;
+        }
+        // strictly inside, halfway between the center and the start
+        double qx = x[i] - cx[i], qy = y[i] - cy[i];
+        double q = std::sqrt(qx * qx + qy * qy);
+        double scale = q > r[i] ? 0.5 * r[i] / q : 0.5;
+        x[i] = cx[i] + scale * qx, y[i] = cy[i] + scale * qy;
+        ++barriers;
+    }
+    auto length = [&]() {
+        double value = 0;
+        for (int i = 0; i < n; ++i) {
+            int j = i + 1 == n ? 0 : i + 1;
+            value += std::sqrt((x[i] - x[j]) * (x[i] - x[j]) + (y[i] - y[j]) * (y[i] - y[j]));
+        }
+        return value;
+    };
+    if (n < 2) return 0;
+
+    gx.resize(n), gy.resize(n);
+    sx.resize(n), sy.resize(n);
+    diag.resize(n), edge.resize(n);
+    inv.resize(n), z.resize(n), v.resize(n);
+    ux.resize(n), uy.resize(n);
+    tx.resize(n), ty.resize(n);
+
+    // each cone barrier has parameter 2, so a centered point is within 2 * barriers * mu of the optimum
+    double start = length();
+    mu = SOLVER_MU_START * start / n;
+    while (true) {
+        for (int k = 0; k < SOLVER_MAX_NEWTON; ++k) {
+            double decrement = newtonStep(x, y) / mu;
+            ++iterations;
+            // backtracking on the barrier, only feasibility is checked once the point is nearly centered
+            double value = decrement < SOLVER_CENTERING ? 0 : barrier(x, y);
+            double step = 1;
+            while (step > 1e-12) {
+                for (int i = 0; i < n; ++i) {
+                    tx[i] = x[i] + step * sx[i];
+                    ty[i] = y[i] + step * sy[i];
+                }
+                double trial = barrier(tx, ty);
+                if (trial < INFINITY && (decrement < SOLVER_CENTERING || trial <= value - 0.25 * step * mu * decrement)) break;
+                step *= 0.5;
+            }
+            if (step <= 1e-12) break;
+            x.swap(tx);
+            y.swap(ty);
+            if (decrement < SOLVER_CENTERING) break;
+        }
+        if (2 * barriers * mu <= tolerance * start) break;
+        mu *= SOLVER_MU_DECREASE;
+    }
+    gap = 2 * barriers * mu;
+    return length();
+}
+
+double SocpIPM::barrier(const Vec& x, const Vec& y) {
+    double value = 0;
+    for (int i = 0; i < n; ++i) {
+        int j = i + 1 == n ? 0 : i + 1;
+        double dx = x[i] - x[j], dy = y[i] - y[j];
+        double t = mu + std::sqrt(mu * mu + dx * dx + dy * dy);
+        value += t - mu * std::log(2 * mu * t);
+        if (fixed[i]) continue;
+        double qx = x[i] - cx[i], qy = y[i] - cy[i];
+        double w = r[i] * r[i] - qx * qx - qy * qy;
+        if (w <= 0) return INFINITY;
+        value -= mu * std::log(w);
+    }
+    return value;
+}
+
+double SocpIPM::newtonStep(const Vec& x, const Vec& y) {
+    for (int i = 0; i < n; ++i) {
+        gx[i] = gy[i] = 0;
+        diag[i] = {0, 0, 0, 0};
+    }
+    // edge i: min over t of t - mu * log(t^2 - |d|^2) is at t = mu + sqrt(mu^2 + |d|^2),
+    // the gradient in d is d / t and the Hessian is I / t - d d^T / (s t^2) with s = t - mu
+    for (int i = 0; i < n; ++i) {
+        int j = i + 1 == n ? 0 : i + 1;
+        double dx = x[i] - x[j], dy = y[i] - y[j];
+        double s = std::sqrt(mu * mu + dx * dx + dy * dy);
+        double t = mu + s;
+        double k = 1 / (s * t * t);
+        Mat2 h = {1 / t - k * dx * dx, -k * dx * dy, -k * dx * dy, 1 / t - k * dy * dy};
+        gx[i] += dx / t, gy[i] += dy / t;
+        gx[j] -= dx / t, gy[j] -= dy / t;
+        for (int m : {i, j}) {
+            diag[m].a += h.a, diag[m].b += h.b, diag[m].c += h.c, diag[m].d += h.d;
+        }
+        edge[i] = {-h.a, -h.b, -h.c, -h.d};
+    }
+    // disk i: -mu * log(r^2 - |q|^2) with q = p - c
+    for (int i = 0; i < n; ++i) {
+        if (fixed[i]) continue;
+        double qx = x[i] - cx[i], qy = y[i] - cy[i];
+        double w = r[i] * r[i] - qx * qx - qy * qy;
+        double a = 2 * mu / w, b = 4 * mu / (w * w);
+        gx[i] += a * qx, gy[i] += a * qy;
+        diag[i].a += a + b * qx * qx, diag[i].d += a + b * qy * qy;
+        diag[i].b += b * qx * qy, diag[i].c += b * qx * qy;
+    }
+    // fixed points do not move
+    for (int i = 0; i < n; ++i) {
+        if (!fixed[i]) continue;
+        int h = i == 0 ? n - 1 : i - 1;
+        gx[i] = gy[i] = 0;
+        diag[i] = {1, 0, 0, 1};
+        edge[h] = {0, 0, 0, 0};
+        edge[i] = {0, 0, 0, 0};
+    }
+    // the step solves H step = -g, the squared decrement is g^T H^-1 g
+    for (int i = 0; i < n; ++i) {
+        sx[i] = -gx[i], sy[i] = -gy[i];
+    }
+    solveSystem();
+    double decrement = 0;
+    for (int i = 0; i < n; ++i) decrement -= gx[i] * sx[i] + gy[i] * sy[i];
+    return decrement;
+}
+
+void SocpIPM::solveSystem() {
+    // unknowns 0 .. m - 1 form a block tridiagonal system, n - 1 is the border coupled to 0 and m - 1
+    int m = n - 1, b = n - 1;
+    auto mul = [](const Mat2& p, const Mat2& q) {
+        return Mat2 {p.a * q.a + p.b * q.c, p.a * q.b + p.b * q.d, p.c * q.a + p.d * q.c, p.c * q.b + p.d * q.d};
+    };
+    auto sub = [](const Mat2& p, const Mat2& q) { return Mat2 {p.a - q.a, p.b - q.b, p.c - q.c, p.d - q.d}; };
+    auto invert = [](const Mat2& p) {
+        double det = p.a * p.d - p.b * p.c;
+        return Mat2 {p.d / det, -p.b / det, -p.c / det, p.a / det};
+    };
+    // coupling of the rows to the border
+    auto coupling = [&](int j) {
+        Mat2 c = {0, 0, 0, 0};
+        if (j == 0) c = edge[b];
+        if (j == m - 1) c = {c.a + edge[m - 1].a, c.b + edge[m - 1].b, c.c + edge[m - 1].c, c.d + edge[m - 1].d};
+        return c;
+    };
+
+    // forward elimination, the right-hand side is in sx, sy
+    for (int j = 0; j < m; ++j) {
+        Mat2 d = diag[j];
+        Mat2 c = coupling(j);
+        if (j > 0) {
+            Mat2 l = mul(edge[j - 1], inv[j - 1]);
+            d = sub(d, mul(l, edge[j - 1]));
+            c = sub(c, mul(l, z[j - 1]));
+            double rx = sx[j - 1], ry = sy[j - 1];
+            sx[j] -= l.a * rx + l.b * ry;
+            sy[j] -= l.c * rx + l.d * ry;
+        }
+        inv[j] = invert(d);
+        z[j] = c;
+    }
+    // back substitution, u = T^-1 rhs and v = T^-1 C
+    for (int j = m - 1; j >= 0; --j) {
+        double rx = sx[j], ry = sy[j];
+        Mat2 c = z[j];
+        if (j < m - 1) {
+            const Mat2& e = edge[j];
+            rx -= e.a * ux[j + 1] + e.b * uy[j + 1];
+            ry -= e.c * ux[j + 1] + e.d * uy[j + 1];
+            c = sub(c, mul(e, v[j + 1]));
+        }
+        const Mat2& p = inv[j];
+        ux[j] = p.a * rx + p.b * ry;
+        uy[j] = p.c * rx + p.d * ry;
+        v[j] = mul(p, c);
+    }
+    // border row, C^T x + D x_b = rhs_b with x = u - v x_b
+    Mat2 s = diag[b];
+    double rx = sx[b], ry = sy[b];
+    int rows[2] = {0, m - 1};
+    for (int k = 0; k < (m == 1 ? 1 : 2); ++k) {
+        int j = rows[k];
+        Mat2 c = coupling(j);                       // the blocks are symmetric
+        s = sub(s, mul(c, v[j]));
+        rx -= c.a * ux[j] + c.b * uy[j];
+        ry -= c.c * ux[j] + c.d * uy[j];
+    }
+    Mat2 si = invert(s);
+    double xb = si.a * rx + si.b * ry, yb = si.c * rx + si.d * ry;
+    for (int j = 0; j < m; ++j) {
+        sx[j] = ux[j] - (v[j].a * xb + v[j].b * yb);
+        sy[j] = uy[j] - (v[j].c * xb + v[j].d * yb);
+    }
+    sx[b] = xb, sy[b] = yb;
+}
@@ -6,102 +6,549 @@
 
 #include "LocalSearch/Solver.hpp"
 
-Solver::Solver() {}
-Solver::~Solver() {}
+Solver::Solver(std::string backend, double gap, bool incremental, bool active_set, int threads)
+    : backend(backend), gap(gap), incremental(incremental), threads(std::max(0, threads)), active_set(active_set) {
+#ifndef CETSP_USE_GUROBI
+    if (backend == "GUROBI") {
+        std::cerr << "[Solver Warning] built without Gurobi, NATIVE is used" << std::endl;
+        this->backend = "NATIVE";
+    }
+#endif
+    if (this->backend != "GUROBI" && this->backend != "NATIVE" && this->backend != "BAND" && this->backend != "DP") {
+        std::cerr << "[Solver Error] unknown backend " << backend << ", NATIVE is used" << std::endl;
+        this->backend = "NATIVE";
+    }
+}
+Solver::~Solver() {
+#ifdef CETSP_USE_GUROBI
+    delete model;
+    delete[] dist;
+    delete[] dx;
+    delete[] dy;
+    delete[] s;
+    delete[] t;
+    delete[] vx;
+    delete[] vy;
+    delete env;
+#endif
+}
 
 void Solver::setContext(Centers &centers) {
     this->centers = centers;
+    batch.clear();
 }
 
-void Solver::solve(List* solution) {
+double Solver::solve(List* solution, double tolerance) {
     auto start = std::chrono::high_resolution_clock::now();
-    // params
-    const int n = centers.size();               // number of points
-    std::vector<double> cx(n);                  // center x
-    std::vector<double> cy(n);                  // center y
-    std::vector<double> r(n);                   // radius
+    this->tolerance = tolerance;
+    double bound = 0;
+    // windows and splits are solved by the interior point method
+    bool native = backend == "NATIVE" || backend == "BAND";
+    bool windowed = incremental && native;
+    if (windowed && solveWindows(solution)) {
+        bound = excess;
+    } else {
+        int n = load(solution);
+        double value = 0;
+        bool split = !active_set && threads > 1 && native && n >= SOLVER_SPLIT_MIN;
+        if (active_set) value = optimizeActive(n);
+        else if (split) value = solveSplit(n);
+        else value = optimize(n, cx.data(), cy.data(), r.data(), x, y);
+        bound = excess;
+        if (!std::isnan(value)) {
+            store(solution, value);
+            // the windows are re-solved around the points of tight full solves only
+            if (windowed && !split && this->tolerance <= SOLVER_TOLERANCE) remember();
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    if (LOG) std::cout << "socp solution : " << solution->getValue() << " time : " << std::chrono::duration<double> (end - start).count() << " s" << std::endl;
+    return bound;
+}
+
+void Solver::solveBatch(const std::vector<List*>& solutions, double tolerance) {
+    int count = std::max(1, std::min(threads, (int) solutions.size()));
+    if (count == 1) {
+        for (List* solution : solutions) solve(solution, tolerance);
+        return;
+    }
+    // the window cache of the incremental mode is kept by this solver only
+    if ((int) batch.size() != count) {
+        batch.clear();
+        for (int k = 0; k < count; ++k) {
+            batch.emplace_back(new Solver(backend, gap, false, active_set, threads / count));
+            batch.back()->setContext(centers);
+        }
+    }
+    std::vector<std::thread> pool;
+    for (int k = 0; k < count; ++k) {
+        pool.emplace_back([this, k, count, &solutions, tolerance]() {
+            for (int i = k; i < (int) solutions.size(); i += count) batch[k]->solve(solutions[i], tolerance);
+        });
+    }
+    for (auto& thread : pool) thread.join();
+}
 
+void Solver::solveExact(List* solution) {
+    int n = load(solution);
+    double value = backend == "GUROBI" ? optimizeGurobi(n, cx.data(), cy.data(), r.data(), x, y) : ipm.solve(n, cx.data(), cy.data(), r.data(), x, y);
+    if (!std::isnan(value)) store(solution, value);
+    if (LOG) std::cout << "exact solution : " << solution->getValue() << std::endl;
+}
+
+int Solver::load(List* solution) {
+    const int n = centers.size();
+    cx.resize(n), cy.resize(n), r.resize(n);
+    x.resize(n), y.resize(n);
+    ids.resize(n);
     Node *p = solution->head();
     for (int i = 0; i < n; ++i) {
+        ids[i] = p->id;
         cx[i] = centers[p->id][0];
         cy[i] = centers[p->id][1];
         r[i] = centers[p->id][2];
+        x[i] = p->x;
+        y[i] = p->y;
         p = p->next;
+    }
+    return n;
+}
 
+void Solver::store(List* solution, double value) {
+    Node *p = solution->head();
+    for (int i = 0; i < solution->size(); ++i) {
+        p->x = x[i];
+        p->y = y[i];
+        p = p->next;
     }
+    solution->setValue(value);
+}
 
-    try {
-        // Create an environment
-        GRBEnv env = GRBEnv(true);
-        // env.set("LogFile", "solve.log");
-        env.set(GRB_IntParam_LogToConsole, 0);
-        env.start();
-
-        // Create an empty model
-        GRBModel model = GRBModel(env);
-
-        double* lbs = new double[n];
-        double* ubs = new double[n];
-        char* types = new char[n];
+double Solver::lowerBound(List* solution, double cutoff) {
+    int n = load(solution);
+    // the gaps between consecutive disks, then the dual of a few rubber band iterations
+    double gaps = 0;
+    for (int i = 0; i < n; ++i) {
+        int j = i + 1 == n ? 0 : i + 1;
+        double c = std::sqrt((cx[i] - cx[j]) * (cx[i] - cx[j]) + (cy[i] - cy[j]) * (cy[i] - cy[j]));
+        gaps += std::max(0.0, c - r[i] - r[j]);
+    }
+    if (gaps >= cutoff) return gaps;
+    RubberBand::Result result = band.solve(n, cx.data(), cy.data(), r.data(), x, y, 0, SOLVER_BOUND_ITERATIONS, cutoff);
+    return std::max(gaps, result.value * (1 - result.gap));
+}
+
+double Solver::optimize(int n, const double* cx, const double* cy, const double* r, std::vector<double>& x, std::vector<double>& y) {
+    excess = 0;
+    if (backend == "GUROBI") {
+        double value = optimizeGurobi(n, cx, cy, r, x, y);
+        excess = std::max(tolerance, SOLVER_GUROBI_TOLERANCE) * value;
+        return value;
+    }
+    if (backend == "NATIVE") {
+        double value = ipm.solve(n, cx, cy, r, x, y, tolerance);
+        excess = ipm.gap;
+        return value;
+    }
+    if (backend == "DP") return dp.solve(n, cx, cy, r, x, y);
+    RubberBand::Result result = band.solve(n, cx, cy, r, x, y, std::max(gap, tolerance));
+    if (LOG) std::cout << "band solution : " << result.value << " iterations : " << result.iterations << " gap : " << result.gap << std::endl;
+    excess = result.gap * result.value;
+    // the band stalls on degenerate tours, the interior point method finishes from its points
+    if (result.gap > std::max(gap, tolerance)) {
+        result.value = ipm.solve(n, cx, cy, r, x, y, tolerance);
+        excess = ipm.gap;
+    }
+    return result.value;
+}
+
+double Solver::optimizeActive(int n) {
+    // closest point to the center i on the segment a - b
+    auto closest = [&](int i, int a, int b, double& px, double& py) {
+        double ex = x[b] - x[a], ey = y[b] - y[a];
+        double e = ex * ex + ey * ey;
+        double k = e > 0 ? ((cx[i] - x[a]) * ex + (cy[i] - y[a]) * ey) / e : 0;
+        k = std::max(0.0, std::min(1.0, k));
+        px = x[a] + k * ex, py = y[a] + k * ey;
+        return std::sqrt((px - cx[i]) * (px - cx[i]) + (py - cy[i]) * (py - cy[i]));
+    };
+    // the first set pulls the current points tight: a disk is dropped if the segment from the last kept one
+    // to the next point crosses it
+    active.assign(n, 0);
+    active[0] = 1;
+    for (int i = 1, a = 0; i < n; ++i) {
+        double px, py;
+        active[i] = closest(i, a, i + 1 == n ? 0 : i + 1, px, py) > r[i];
+        if (active[i]) a = i;
+    }
+    double value = 0;
+    int rounds = 0;
+    while (true) {
+        ++rounds;
+        order.clear();
         for (int i = 0; i < n; ++i) {
-            lbs[i] = -GRB_INFINITY;
-            ubs[i] = GRB_INFINITY;
-            types[i] = GRB_CONTINUOUS;
+            if (active[i]) order.push_back(i);
+        }
+        if (order.empty()) {
+            active[0] = 1;
+            continue;
+        }
+        int m = order.size();
+        acx.resize(m), acy.resize(m), ar.resize(m), ax.resize(m), ay.resize(m);
+        for (int k = 0; k < m; ++k) {
+            int i = order[k];
+            acx[k] = cx[i], acy[k] = cy[i], ar[k] = r[i];
+            ax[k] = x[i], ay[k] = y[i];
+        }
+        value = optimize(m, acx.data(), acy.data(), ar.data(), ax, ay);
+        if (std::isnan(value)) return value;
+        for (int k = 0; k < m; ++k) {
+            x[order[k]] = ax[k];
+            y[order[k]] = ay[k];
         }
+        // the dropped disks between two constrained ones must be crossed in order by the segment a - b:
+        // each takes the first point of its chord after the previous one, the ones missed are constrained in the next round.
+        // chords are taken with the radius plus the tolerance, a point outside the disk is then moved onto it,
+        // which lengthens the path by at most twice the tolerance
+        double slack = tolerance * value / n;
+        int added = 0;
+        for (int k = 0; k < m; ++k) {
+            int a = order[k], b = order[(k + 1) % m];
+            double ex = x[b] - x[a], ey = y[b] - y[a];
+            double e = ex * ex + ey * ey;
+            double at = 0;
+            for (int i = (a + 1) % n; i != b && i != a; i = (i + 1) % n) {
+                double fx = cx[i] - x[a], fy = cy[i] - y[a];
+                double f = fx * ex + fy * ey;
+                double w = fx * fx + fy * fy - (r[i] + slack) * (r[i] + slack);
+                double lo = 0, hi = w <= 0 ? 1 : -1;
+                if (e > 0) {
+                    double disc = f * f - e * w;
+                    lo = disc < 0 ? 2 : (f - std::sqrt(disc)) / e;
+                    hi = disc < 0 ? -1 : std::min(1.0, (f + std::sqrt(disc)) / e);
+                }
+                if (std::max(at, lo) > hi) {
+                    closest(i, a, b, x[i], y[i]);
+                    active[i] = 1;
+                    ++added;
+                    continue;
+                }
+                at = std::max(at, lo);
+                x[i] = x[a] + at * ex, y[i] = y[a] + at * ey;
+                double qx = x[i] - cx[i], qy = y[i] - cy[i];
+                double q = std::sqrt(qx * qx + qy * qy);
+                if (q > r[i]) x[i] = cx[i] + r[i] / q * qx, y[i] = cy[i] + r[i] / q * qy;
+            }
+        }
+        if (added == 0) break;
+    }
+    value = length();
+    excess += 2 * tolerance * value;
+    if (LOG) std::cout << "socp active : " << order.size() << " / " << n << " rounds : " << rounds << std::endl;
+    return value;
+}
 
-        // Create variables
-        GRBVar* dist = model.addVars(lbs, ubs, nullptr, types, nullptr, n);         // distance
-        GRBVar* dx = model.addVars(lbs, ubs, nullptr, types, nullptr, n);           // x diff
-        GRBVar* dy = model.addVars(lbs, ubs, nullptr, types, nullptr, n);           // y diff
-        GRBVar* s = model.addVars(lbs, ubs, nullptr, types, nullptr, n);            // turing point x
-        GRBVar* t = model.addVars(lbs, ubs, nullptr, types, nullptr, n);            // turing point y
-        GRBVar* x = model.addVars(lbs, ubs, nullptr, types, nullptr, n);            // turing point x
-        GRBVar* y = model.addVars(lbs, ubs, nullptr, types, nullptr, n);            // turing point y
-
-        // Set objective
-        GRBLinExpr obj = 0;
-        for (int i = 0; i < n; ++i) {
-            obj += dist[i];
+void Solver::remember() {
+    int n = ids.size();
+    if ((int) exacts.size() < SOLVER_WINDOW_CACHE) exacts.emplace_back();
+    Exact& e = exacts[exact_next];
+    exact_next = (exact_next + 1) % SOLVER_WINDOW_CACHE;
+    e.pre.resize(n), e.next.resize(n), e.x.resize(n), e.y.resize(n);
+    for (int i = 0; i < n; ++i) {
+        e.pre[ids[i]] = ids[i == 0 ? n - 1 : i - 1];
+        e.next[ids[i]] = ids[i + 1 == n ? 0 : i + 1];
+        e.x[ids[i]] = x[i];
+        e.y[ids[i]] = y[i];
+    }
+}
+
+bool Solver::solveWindows(List* solution) {
+    int n = load(solution);
+    if (n < 4) return false;
+    // a node is unchanged if it has the same two neighbors, in either orientation
+    auto unchanged = [&](const Exact& e, int i) {
+        int a = ids[i == 0 ? n - 1 : i - 1], b = ids[i + 1 == n ? 0 : i + 1];
+        int p = e.pre[ids[i]], q = e.next[ids[i]];
+        return (a == p && b == q) || (a == q && b == p);
+    };
+    const Exact* best = nullptr;
+    int best_count = -1;
+    for (const Exact& e : exacts) {
+        if ((int) e.pre.size() != n) continue;
+        int count = 0;
+        for (int i = 0; i < n; ++i) count += unchanged(e, i);
+        if (count > best_count) best = &e, best_count = count;
+    }
+    if (best == nullptr) return false;
+
+    // changed nodes and a margin around them are re-solved, the other points come from the cached solve
+    marked.assign(n, 0);
+    for (int i = 0; i < n; ++i) {
+        if (unchanged(*best, i)) continue;
+        for (int k = -SOLVER_WINDOW_MARGIN; k <= SOLVER_WINDOW_MARGIN; ++k) marked[((i + k) % n + n) % n] = 1;
+    }
+    int count = 0;
+    for (int i = 0; i < n; ++i) count += marked[i];
+    if (count > SOLVER_WINDOW_COVER * n) return false;
+    for (int i = 0; i < n; ++i) {
+        x[i] = best->x[ids[i]];
+        y[i] = best->y[ids[i]];
+    }
+
+    windows.clear();
+    int first = 0;
+    while (marked[first]) ++first;
+    for (int k = 1; k <= n; ++k) {
+        int i = (first + k) % n;
+        if (!marked[i]) continue;
+        if (marked[(i - 1 + n) % n]) ++windows.back().second;
+        else windows.emplace_back(i, 1);
+    }
+    runWindows();
+    store(solution, certify(n));
+    if (LOG) std::cout << "socp windows : " << windows.size() << " nodes : " << count << " gap : " << excess << std::endl;
+    return true;
+}
+
+void Solver::runWindows() {
+    // windows do not share points, so they are solved in parallel
+    int count = std::max(1, std::min(threads, (int) windows.size()));
+    workers.resize(std::max((int) workers.size(), count));
+    if (count == 1) {
+        for (auto& window : windows) solveWindow(workers[0], window.first, window.second);
+        return;
+    }
+    std::vector<std::thread> pool;
+    for (int k = 0; k < count; ++k) {
+        pool.emplace_back([this, k, count]() {
+            for (int w = k; w < (int) windows.size(); w += count) solveWindow(workers[k], windows[w].first, windows[w].second);
+        });
+    }
+    for (auto& thread : pool) thread.join();
+}
+
+double Solver::solveSplit(int n) {
+    // one window per thread between fixed boundary points, the boundaries move by half a window every sweep,
+    // so each point is free in every other sweep at least. the sweeps stop when the length stalls
+    int k = std::min(threads, n / 4);
+    int block = n / k;
+    double value = length();
+    int sweeps = 0;
+    while (sweeps < SOLVER_SPLIT_SWEEPS) {
+        int offset = sweeps % 2 == 0 ? 0 : block / 2;
+        windows.clear();
+        for (int i = 0; i < k; ++i) {
+            int first = offset + i * block + 1;
+            int last = i + 1 == k ? offset + n - 1 : offset + (i + 1) * block - 1;
+            windows.emplace_back(first % n, last - first + 1);
         }
-        model.setObjective(obj, GRB_MINIMIZE);
+        runWindows();
+        ++sweeps;
+        double current = length();
+        bool stalled = value - current <= SOLVER_TOLERANCE * current;
+        value = current;
+        if (sweeps >= 2 && stalled) break;
+    }
+    value = certify(n);
+    if (LOG) std::cout << "socp split : " << k << " windows sweeps : " << sweeps << " gap : " << excess << std::endl;
+    return value;
+}
 
-        for (int i = 0; i < n - 1; ++i) {
-            model.addConstr(dx[i] == x[i] - x[i+1]);
-            model.addConstr(dy[i] == y[i] - y[i+1]);
+double Solver::length() const {
+    int n = x.size();
+    double value = 0;
+    for (int i = 0; i < n; ++i) {
+        int j = i + 1 == n ? 0 : i + 1;
+        value += std::sqrt((x[i] - x[j]) * (x[i] - x[j]) + (y[i] - y[j]) * (y[i] - y[j]));
+    }
+    return value;
+}
+
+double Solver::certify(int n) {
+    // windows are optimal with their ends fixed only, so the gap of the whole tour comes from its own dual: unit vectors
+    // u[i] on the edges bound the optimum by sum c[i] . g[i] - r[i] |g[i]| with g[i] = u[i] - u[i - 1], see RubberBand.
+    // the edges keep their directions. the points between two of them, joined by edges of about zero length, turn from
+    // the first direction to the second at one of their disks, or at two along the normals of their points, as at the
+    // corner of two disks, whichever bounds most. any unit vectors give a bound, the choice only makes it tight
+    auto term = [&](int i, double gx, double gy) { return cx[i] * gx + cy[i] * gy - r[i] * std::sqrt(gx * gx + gy * gy); };
+    double value = length();
+    double shortest = SOLVER_CERTIFY_EDGE * value / n;
+    ux.resize(n), uy.resize(n);
+    int first = -1;
+    for (int i = 0; i < n; ++i) {
+        int j = i + 1 == n ? 0 : i + 1;
+        double dx = x[i] - x[j], dy = y[i] - y[j];
+        double d = std::sqrt(dx * dx + dy * dy);
+        ux[i] = d > shortest ? dx / d : 0;
+        uy[i] = d > shortest ? dy / d : 0;
+        if (d > shortest && first < 0) first = i;
+    }
+    double lower = 0;
+    for (int k = 1, in = first; first >= 0 && k <= n; ++k) {
+        int out = (first + k) % n;
+        if (ux[out] == 0 && uy[out] == 0) continue;
+        double gx = ux[out] - ux[in], gy = uy[out] - uy[in];
+        double best = -INFINITY;
+        for (int a = (in + 1) % n; ; a = (a + 1) % n) {
+            best = std::max(best, term(a, gx, gy));
+            double ax = x[a] - cx[a], ay = y[a] - cy[a];
+            double da = std::sqrt(ax * ax + ay * ay);
+            for (int b = (a + 1) % n; a != out && da > 0; b = (b + 1) % n) {
+                double bx = x[b] - cx[b], by = y[b] - cy[b];
+                double db = std::sqrt(bx * bx + by * by);
+                double det = (ax * by - ay * bx) / (da * db);
+                if (db > 0 && std::abs(det) > 1e-12) {
+                    // g = -la na - lb nb with the outer normals na, nb, the edges between a and b take u[in] - la na,
+                    // shortened to a unit vector if needed
+                    double la = -(gx * by - gy * bx) / db / det;
+                    double mx = ux[in] - la * ax / da, my = uy[in] - la * ay / da;
+                    double m = std::sqrt(mx * mx + my * my);
+                    if (m > 1) mx /= m, my /= m;
+                    best = std::max(best, term(a, mx - ux[in], my - uy[in]) + term(b, ux[out] - mx, uy[out] - my));
+                }
+                if (b == out) break;
+            }
+            if (a == out) break;
         }
+        lower += best;
+        in = out;
+    }
+    excess = std::max(0.0, value - lower);
+    return value;
+}
+
+void Solver::solveWindow(Window& w, int first, int len) {
+    // the path a, window, b is closed by the fixed edge b - a, which does not move the optimum
+    int n = ids.size();
+    int m = len + 2;
+    w.cx.resize(m), w.cy.resize(m), w.r.resize(m), w.x.resize(m), w.y.resize(m);
+    for (int k = 0; k < m; ++k) {
+        int i = (first - 1 + k + n) % n;
+        bool fixed = k == 0 || k == m - 1;
+        w.cx[k] = fixed ? x[i] : cx[i];
+        w.cy[k] = fixed ? y[i] : cy[i];
+        w.r[k] = fixed ? 0 : r[i];
+        w.x[k] = x[i];
+        w.y[k] = y[i];
+    }
+    w.ipm.solve(m, w.cx.data(), w.cy.data(), w.r.data(), w.x, w.y);
+    for (int k = 1; k < m - 1; ++k) {
+        int i = (first - 1 + k + n) % n;
+        x[i] = w.x[k];
+        y[i] = w.y[k];
+    }
+}
 
-        model.addConstr(dx[n-1] == x[n-1] - x[0]);
-        model.addConstr(dy[n-1] == y[n-1] - y[0]);
+#ifdef CETSP_USE_GUROBI
+void Solver::buildModel(int n) {
+    delete model;
+    delete[] dist;
+    delete[] dx;
+    delete[] dy;
+    delete[] s;
+    delete[] t;
+    delete[] vx;
+    delete[] vy;
+    model = new GRBModel(*env);
 
+    double* lbs = new double[n];
+    double* ubs = new double[n];
+    char* types = new char[n];
+    for (int i = 0; i < n; ++i) {
+        lbs[i] = -GRB_INFINITY;
+        ubs[i] = GRB_INFINITY;
+        types[i] = GRB_CONTINUOUS;
+    }
+
+    // Create variables
+    dist = model->addVars(lbs, ubs, nullptr, types, nullptr, n);         // distance
+    dx = model->addVars(lbs, ubs, nullptr, types, nullptr, n);           // x diff
+    dy = model->addVars(lbs, ubs, nullptr, types, nullptr, n);           // y diff
+    s = model->addVars(lbs, ubs, nullptr, types, nullptr, n);            // turing point x
+    t = model->addVars(lbs, ubs, nullptr, types, nullptr, n);            // turing point y
+    vx = model->addVars(lbs, ubs, nullptr, types, nullptr, n);           // turing point x
+    vy = model->addVars(lbs, ubs, nullptr, types, nullptr, n);           // turing point y
+
+    // Set objective
+    GRBLinExpr obj = 0;
+    for (int i = 0; i < n; ++i) {
+        obj += dist[i];
+    }
+    model->setObjective(obj, GRB_MINIMIZE);
+
+    for (int i = 0; i < n - 1; ++i) {
+        model->addConstr(dx[i] == vx[i] - vx[i+1]);
+        model->addConstr(dy[i] == vy[i] - vy[i+1]);
+    }
+
+    model->addConstr(dx[n-1] == vx[n-1] - vx[0]);
+    model->addConstr(dy[n-1] == vy[n-1] - vy[0]);
+
+    // only the centers and the radii depend on the sequence, they are set by optimizeGurobi
+    center_x.resize(n);
+    center_y.resize(n);
+    disks.resize(n);
+    for (int i = 0; i < n; ++i) {
+        center_x[i] = model->addConstr(s[i] + vx[i] == 0);
+        center_y[i] = model->addConstr(t[i] + vy[i] == 0);
+        model->addQConstr(dist[i] * dist[i] >= dx[i] * dx[i] + dy[i] * dy[i]);
+        disks[i] = model->addQConstr(s[i] * s[i] + t[i] * t[i] <= 1);
+        model->addConstr(dist[i] >= 0);
+    }
+    model->update();
+    model_size = n;
+
+    delete[] lbs;
+    delete[] ubs;
+    delete[] types;
+}
+
+double Solver::optimizeGurobi(int n, const double* cx, const double* cy, const double* r, std::vector<double>& x, std::vector<double>& y) {
+    auto start = std::chrono::high_resolution_clock::now();
+    try {
+        // the environment and the model of a size are kept, so the license is checked once
+        if (env == nullptr) {
+            env = new GRBEnv(true);
+            env->set(GRB_IntParam_LogToConsole, 0);
+            if (threads > 0) env->set(GRB_IntParam_Threads, threads);      // 0: Gurobi chooses
+            env->start();
+        }
+        if (model_size != n) buildModel(n);
         for (int i = 0; i < n; ++i) {
-            model.addConstr(s[i] == cx[i] - x[i]);
-            model.addConstr(t[i] == cy[i] - y[i]);
-            model.addQConstr(dist[i] * dist[i] >= dx[i] * dx[i] + dy[i] * dy[i]);
-            model.addQConstr(r[i] * r[i] >= s[i] * s[i] + t[i] * t[i]);
-            model.addConstr(dist[i] >= 0);
+            center_x[i].set(GRB_DoubleAttr_RHS, cx[i]);
+            center_y[i].set(GRB_DoubleAttr_RHS, cy[i]);
+            disks[i].set(GRB_DoubleAttr_QCRHS, r[i] * r[i]);
         }
+        model->set(GRB_DoubleParam_BarQCPConvTol, std::max(tolerance, SOLVER_GUROBI_TOLERANCE));
+        auto built = std::chrono::high_resolution_clock::now();
 
         // Optimize model
-        model.optimize();
-        Node* p = solution->head();
+        model->optimize();
+        auto end = std::chrono::high_resolution_clock::now();
         for (int i = 0 ; i < n; ++i) {
-            p->x = x[i].get(GRB_DoubleAttr_X);
-            p->y = y[i].get(GRB_DoubleAttr_X);
-            p = p->next;
+            x[i] = vx[i].get(GRB_DoubleAttr_X);
+            y[i] = vy[i].get(GRB_DoubleAttr_X);
         }
+        double value = model->get(GRB_DoubleAttr_ObjVal);
 
-        solution->setValue(model.get(GRB_DoubleAttr_ObjVal));
-
-        delete[] lbs;
-        delete[] ubs;
-        delete[] types;
-
+        build_time += std::chrono::duration<double> (built - start).count();
+        optimize_time += std::chrono::duration<double> (end - built).count();
+        if (LOG) std::cout << "gurobi build : " << std::chrono::duration<double> (built - start).count() << " s optimize : "
+                           << std::chrono::duration<double> (end - built).count() << " s total build : " << build_time
+                           << " s total optimize : " << optimize_time << " s" << std::endl;
+        return value;
     } catch(GRBException e) {
         std::cout << "Error code = " << e.getErrorCode() << std::endl;
         std::cout << e.getMessage() << std::endl;
+        model_size = 0;                         // rebuilt on the next call
     } catch(...) {
         std::cout << "Exception during optimization" << std::endl;
+        model_size = 0;
     }
-    auto end = std::chrono::high_resolution_clock::now();
-    if (LOG) std::cout << "socp solution : " << solution->getValue() << " time : " << std::chrono::duration<double> (end - start).count() << " s" << std::endl;
-}
\ No newline at end of file
+    return NAN;
+}
+#else
+double Solver::optimizeGurobi(int, const double*, const double*, const double*, std::vector<double>&, std::vector<double>&) {
+    return NAN;
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,116 @@
+/**
+ * TwoLevelList.cpp
+ * created on : Oct 17 2026
+ **/
+
+#include "LocalSearch/TwoLevelList.hpp"
+#include <cmath>
+#include <algorithm>
+
+TwoLevelList::TwoLevelList() {}
+TwoLevelList::~TwoLevelList() {}
+
+void TwoLevelList::init(const std::vector<int>& tour) {
+    n = tour.size();
+    group = std::max(1, (int) std::sqrt((double) n));
+    seg.resize(n), index.resize(n);
+    rebuild(tour);
+}
+
+void TwoLevelList::rebuild(const std::vector<int>& tour) {
+    int m = (n + group - 1) / group;
+    segments.assign(m, Segment());
+    order.resize(m);
+    for (int s = 0; s < m; ++s) {
+        Segment& segment = segments[s];
+        segment.ids.assign(tour.begin() + s * group, tour.begin() + std::min(n, (s + 1) * group));
+        segment.rank = s;
+        order[s] = s;
+        for (int i = 0; i < (int) segment.ids.size(); ++i) seg[segment.ids[i]] = s, index[segment.ids[i]] = i;
+    }
+    limit = 2 * m;
+}
+
+int TwoLevelList::offset(int id) const {
+    const Segment& segment = segments[seg[id]];
+    return segment.reversed ? (int) segment.ids.size() - 1 - index[id] : index[id];
+}
+
+int TwoLevelList::at(int s, int k) const {
+    const Segment& segment = segments[s];
+    return segment.reversed ? segment.ids[segment.ids.size() - 1 - k] : segment.ids[k];
+}
+
+int TwoLevelList::next(int id) const {
+    int s = seg[id], k = offset(id);
+    if (k + 1 < (int) segments[s].ids.size()) return at(s, k + 1);
+    int rank = segments[s].rank + 1;
+    return at(order[rank == (int) order.size() ? 0 : rank], 0);
+}
+
+int TwoLevelList::prev(int id) const {
+    int s = seg[id], k = offset(id);
+    if (k > 0) return at(s, k - 1);
+    int rank = segments[s].rank == 0 ? (int) order.size() - 1 : segments[s].rank - 1;
+    return at(order[rank], segments[order[rank]].ids.size() - 1);
+}
+
+bool TwoLevelList::before(int a, int b) const {
+    int ra = segments[seg[a]].rank, rb = segments[seg[b]].rank;
+    return ra != rb ? ra < rb : offset(a) < offset(b);
+}
+
+bool TwoLevelList::between(int a, int b, int c) const {
+    if (!before(c, a)) return !before(b, a) && !before(c, b);
+    return !before(b, a) || !before(c, b);
+}
+
+void TwoLevelList::split(int id) {
+    int s = seg[id], k = offset(id);
+    if (k == 0) return;
+    // the part from id on moves to a new segment right after s, both parts are stored in tour direction
+    int size = segments[s].ids.size();
+    buffer.resize(size);
+    for (int i = 0; i < size; ++i) buffer[i] = at(s, i);
+    int t = segments.size();
+    segments.emplace_back();
+    Segment& tail = segments[t];
+    Segment& head = segments[s];
+    head.ids.assign(buffer.begin(), buffer.begin() + k);
+    tail.ids.assign(buffer.begin() + k, buffer.end());
+    head.reversed = false;
+    for (int i = 0; i < k; ++i) index[buffer[i]] = i;
+    for (int i = k; i < size; ++i) seg[buffer[i]] = t, index[buffer[i]] = i - k;
+    order.insert(order.begin() + head.rank + 1, t);
+    for (int r = head.rank + 1; r < (int) order.size(); ++r) segments[order[r]].rank = r;
+}
+
+void TwoLevelList::reverse(int a, int b) {
+    if (a == b || next(b) == a) return;
+    split(a);
+    split(next(b));
+    int m = order.size();
+    int first = segments[seg[a]].rank, count = (segments[seg[b]].rank - first + m) % m + 1;
+    // the complement gives the same tour read backwards
+    if (2 * count > m) {
+        first = (first + count) % m;
+        count = m - count;
+    }
+    for (int i = 0; i < count / 2; ++i) std::swap(order[(first + i) % m], order[(first + count - 1 - i) % m]);
+    for (int i = 0; i < count; ++i) {
+        int r = (first + i) % m;
+        segments[order[r]].reversed = !segments[order[r]].reversed;
+        segments[order[r]].rank = r;
+    }
+    if (m > limit) {
+        tour(buffer);
+        rebuild(std::vector<int>(buffer));
+    }
+}
+
+void TwoLevelList::tour(std::vector<int>& out) const {
+    out.clear();
+    for (int s : order) {
+        for (int k = 0; k < (int) segments[s].ids.size(); ++k) out.push_back(at(s, k));
+    }
+}
@@ -10,6 +10,11 @@
 
 #include "Defs.hpp"
 
+#ifndef _WIN32
+#define _popen popen
+#define _pclose pclose
+#endif
+
 double SurvivalModel::predict_survival_score(
     const std::string& json_features)
 {
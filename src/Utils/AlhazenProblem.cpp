@@ -11,7 +11,7 @@ AlhazenProblem::AlhazenProblem(double x1, double y1, double x2, double y2, doubl
 
 AlhazenProblem::~AlhazenProblem() {}
 
-std::vector<double> AlhazenProblem::solve() {
+std::array<double, 3> AlhazenProblem::solve() {
     double a = -1, b = -1;
     double angle;
     findBoundary(a, b);
@@ -23,19 +23,20 @@ std::vector<double> AlhazenProblem::solve() {
     double x = O.x + R * cos(angle);
     double y = O.y + R * sin(angle);
     double z = 0;
-    return std::vector<double> {x, y, z};
+    return {x, y, z};
 }
 
 void AlhazenProblem::findBoundary(double& a, double& b) {
-    std::vector<double> keys = {0, PI / 2, PI, 3 * PI / 2, 2 * PI};
-    std::vector<double> values = {functionPrime(0), functionPrime(PI / 2), functionPrime(PI), functionPrime(3 * PI / 2), functionPrime(2 * PI)};
-    for (int i = 0; i < values.size() - 1; ++i) {
+    const double keys[] = {0, PI / 2, PI, 3 * PI / 2, 2 * PI};
+    const double values[] = {functionPrime(0), functionPrime(PI / 2), functionPrime(PI), functionPrime(3 * PI / 2), functionPrime(2 * PI)};
+    const int size = 5;
+    for (int i = 0; i < size - 1; ++i) {
         if (abs(values[i]) < EPSILON && functionPrime(keys[i] - PI / 2) < 0 && functionPrime(keys[i] + PI / 2) > 0) {
             a = keys[i], b = keys[i];
             return;
         }
     }
-    for (int i = 0; i < values.size() - 1; ++i) {
+    for (int i = 0; i < size - 1; ++i) {
         if (values[i] * values[i+1] < 0) {
             if (values[i] < 0 && values[i+1] > 0) {
                 a = keys[i], b = keys[i+1];
@@ -18,12 +18,27 @@ Parameters::Parameters(int argc, char **argv) {
     parser.add<std::string>("improvement", '\0', "improvement", false, IMPROVEMENT);
     parser.add<std::string>("greed", '\0', "greed", false, GREEDY_ALGO);
     parser.add<std::string>("distance", '\0', "distance", false, DISTANCE);
+    parser.add<std::string>("lkh_backend", '\0', "LKH backend (LIB, FILE, POOL)", false, LKH_BACKEND);
+    parser.add<int>("lkh_workers", '\0', "LKH worker processes of the POOL backend", false, LKH_WORKERS);
+    parser.add<bool>("lkh_fix", '\0', "fix the edges common to both parents when LKH improves an offspring", false, LKH_FIX_EDGES);
+    parser.add<bool>("lkh_adaptive", '\0', "adapt the LKH effort to the measured gain per second", false, LKH_ADAPTIVE);
+    parser.add<std::string>("lkh_cost", '\0', "edge cost given to LKH (POINT, DISK)", false, LKH_COST);
+    parser.add<double>("lkh_point_weight", '\0', "weight of the turning points in the DISK cost", false, LKH_POINT_WEIGHT);
+    parser.add<std::string>("solver", '\0', "solver of the turning points (GUROBI, NATIVE, BAND, DP)", false, SOLVER_BACKEND);
+    parser.add<bool>("solver_incremental", '\0', "re-solve only the windows of the tour that changed", false, SOLVER_INCREMENTAL);
+    parser.add<bool>("solver_active", '\0', "solve with only the disks the path does not cross", false, SOLVER_ACTIVE_SET);
+    parser.add<int>("solver_threads", '\0', "threads of the solvers, NATIVE and BAND split large tours between them, 0 leaves GUROBI its default", false, SOLVER_THREADS);
+    parser.add<double>("solver_gap", '\0', "relative gap at which the BAND solver stops", false, SOLVER_BAND_GAP);
+    parser.add<std::string>("seq_opt", '\0', "sequence optimizer of the VND (LKH, NATIVE, AUTO)", false, SEQ_OPT);
+    parser.add<double>("lkh_cache_tol", '\0', "drift tolerance of cached LKH candidates, < 0 disables", false, LKH_CACHE_TOLERANCE);
     // parameters
     parser.add<int>("pop_size", 'p', "population size", false, POPULATION_SIZE);
     parser.add<int>("iteration", 'r', "iteration", false, ITERATION);
     parser.add<double>("max_time", 't', "max running time", false, MAX_TIME);
     parser.add<double>("fit_beta", 'b', "coefficient for fitness function", false, FIT_BETA);
     parser.add<int>("dist_th", 'd', "distance threshold", false, DISTANCE_THRESHOLD);
+    parser.add<bool>("prune", '\0', "skip the exact solve when a lower bound shows the offspring cannot enter", false, PRUNE);
+    parser.add<bool>("adaptive_precision", '\0', "solve coarsely the offspring the population does not keep", false, ADAPTIVE_PRECISION);
     parser.add<int>("neighbor_size", 'n', "neighbor size", false, NEIGHBOR_SIZE);
 
     parser.parse_check(argc, argv);
@@ -37,12 +52,27 @@ Parameters::Parameters(int argc, char **argv) {
     improvement = parser.get<std::string>("improvement");
     greed = parser.get<std::string>("greed");
     distance = parser.get<std::string>("distance");
+    lkh_backend = parser.get<std::string>("lkh_backend");
+    lkh_workers = parser.get<int>("lkh_workers");
+    lkh_cache_tol = parser.get<double>("lkh_cache_tol");
+    lkh_fix = parser.get<bool>("lkh_fix");
+    lkh_adaptive = parser.get<bool>("lkh_adaptive");
+    lkh_cost = parser.get<std::string>("lkh_cost");
+    lkh_point_weight = parser.get<double>("lkh_point_weight");
+    seq_opt = parser.get<std::string>("seq_opt");
+    solver = parser.get<std::string>("solver");
+    solver_gap = parser.get<double>("solver_gap");
+    solver_incremental = parser.get<bool>("solver_incremental");
+    solver_active = parser.get<bool>("solver_active");
+    solver_threads = parser.get<int>("solver_threads");
     population_size = parser.get<int>("pop_size");
     iteration = parser.get<int>("iteration");
     patience = iteration ;
     max_time = parser.get<double>("max_time");
     fit_beta = parser.get<double>("fit_beta");
     dist_th = parser.get<int>("dist_th");
+    prune = parser.get<bool>("prune");
+    adaptive_precision = parser.get<bool>("adaptive_precision");
     neighbor_size = parser.get<int>("neighbor_size");
     timestamp = std::to_string(std::time(nullptr));
 }
@@ -57,7 +87,9 @@ void Parameters::print() const {
               << " max_time: " << max_time
               << " fit_beta: " << fit_beta
               << " dist_th: " << dist_th
+              << " prune: " << prune
+              << " adaptive_precision: " << adaptive_precision
               << " neighbor_size: " << neighbor_size
               << " timestamp: " << timestamp
               << std::endl;
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+/**
+ * LKHStress.cpp
+ * created on : Oct 17 2026
+ **/
+
+// concurrent LKH calls on one object: every thread solves its own instances, of a size no other task has, and must
+// get back a valid tour of its own nodes, the same one a call alone gets
+// usage: LKHStress <LIB|FILE|POOL> <threads> <calls per thread>
+
+#include "LocalSearch/LKH.hpp"
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+struct Instance {
+    std::vector<double> x, y;
+    std::vector<int> tour;          // initial
+};
+
+static Instance makeInstance(int index) {
+    Instance inst;
+    int n = 40 + 7 * index;
+    std::mt19937 rng(index + 1);
+    std::uniform_real_distribution<double> coord(0, 1000);
+    for (int i = 0; i < n; ++i) {
+        inst.x.push_back(coord(rng));
+        inst.y.push_back(coord(rng));
+        inst.tour.push_back(i);
+    }
+    std::shuffle(inst.tour.begin(), inst.tour.end(), rng);
+    return inst;
+}
+
+// ids in tour order from id 0, in the direction of its smaller neighbor, empty if the tour is not valid
+static std::vector<int> solve(LKH& lkh, const Instance& inst, std::string& error) {
+    int n = inst.tour.size();
+    List* s = new List();
+    for (int id : inst.tour) s->add(new Node(id, inst.x[id], inst.y[id]));
+    s->evaluate();
+    double before = s->getValue();
+    lkh.run(s, false);
+
+    std::vector<int> order;
+    std::vector<char> seen(n, 0);
+    Node* p = s->head();
+    for (int i = 0; i < s->size(); ++i, p = p->next) {
+        if (p->id < 0 || p->id >= n || seen[p->id] || p->x != inst.x[p->id] || p->y != inst.y[p->id]
+            || p->next->pre != p) {
+            error = "not a tour of its own nodes";
+            break;
+        }
+        seen[p->id] = 1;
+        order.push_back(p->id);
+    }
+    if (error.empty() && (s->size() != n || (int) order.size() != n)) error = "wrong size";
+    if (error.empty() && s->getValue() > before + 1e-9) error = "longer than the initial tour";
+    delete s;
+    if (!error.empty()) return {};
+
+    int at = std::find(order.begin(), order.end(), 0) - order.begin();
+    std::rotate(order.begin(), order.begin() + at, order.end());
+    if (order[n - 1] < order[1]) std::reverse(order.begin() + 1, order.end());
+    return order;
+}
+
+int main(int argc, char** argv) {
+    std::string backend = argc > 1 ? argv[1] : "POOL";
+    int threads = argc > 2 ? std::atoi(argv[2]) : 8;
+    int calls = argc > 3 ? std::atoi(argv[3]) : 4;
+    int tasks = threads * calls;
+
+    // no cache and a fixed effort, a call gives the same tour whatever runs next to it
+    LKH lkh(backend, threads, -1, false, false);
+    lkh.setContext("stress", 0);
+    std::vector<Instance> instances;
+    std::vector<std::vector<int>> expected(tasks);
+    for (int i = 0; i < tasks; ++i) {
+        instances.push_back(makeInstance(i));
+        std::string error;
+        expected[i] = solve(lkh, instances[i], error);
+        if (!error.empty()) {
+            std::cerr << "[STRESS Error] task " << i << " alone: " << error << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<std::string> errors(tasks);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t]() {
+            for (int c = 0; c < calls; ++c) {
+                int i = t * calls + c;
+                std::vector<int> order = solve(lkh, instances[i], errors[i]);
+                if (errors[i].empty() && order != expected[i]) errors[i] = "differs from the tour of the call alone";
+            }
+        });
+    }
+    for (auto& t : pool) t.join();
+
+    int failed = 0;
+    for (int i = 0; i < tasks; ++i) {
+        if (errors[i].empty()) continue;
+        std::cerr << "[STRESS Error] task " << i << ": " << errors[i] << std::endl;
+        ++failed;
+    }
+    std::cout << "[STRESS] backend: " << backend << " threads: " << threads << " tasks: " << tasks
+              << " failed: " << failed << std::endl;
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+/**
+ * NodeSoak.cpp
+ * created on : Oct 17 2026
+ **/
+
+// a long churn of tours shaped like the one of Population: offspring copied from shared members, edited, kept or
+// reset for reuse, members dropped. the resident size must stay flat once the pools are warm and no node may be
+// left at the end
+// usage: NodeSoak <rounds> <tour size> <population size>
+
+#include "Genetic/TourSnapshot.hpp"
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <unistd.h>
+
+static long residentKB() {
+    long pages = 0, resident = 0;
+    std::ifstream in("/proc/self/statm");
+    in >> pages >> resident;
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static List* makeTour(int n, std::mt19937& rng) {
+    std::uniform_real_distribution<double> coord(0, 1000);
+    List* s = new List();
+    for (int i = 0; i < n; ++i) s->add(new Node(i, coord(rng), coord(rng)));
+    s->evaluate();
+    return s;
+}
+
+// a few moves of the VND: node swaps and a relocation, through remove and a new node
+static void mutate(List* s, std::mt19937& rng) {
+    std::uniform_int_distribution<int> pick(0, s->size() - 1);
+    for (int k = 0; k < 4; ++k) {
+        Node* a = s->head(), *b = s->head();
+        for (int i = pick(rng); i > 0; --i) a = a->next;
+        for (int i = pick(rng); i > 0; --i) b = b->next;
+        Node::swap(a, b);
+    }
+    Node* p = s->head()->next;
+    Node* moved = new Node(*p);
+    s->remove(p);
+    s->add(moved, s->head());
+    s->evaluate();
+}
+
+int main(int argc, char** argv) {
+    int rounds = argc > 1 ? std::atoi(argv[1]) : 200000;
+    int n = argc > 2 ? std::atoi(argv[2]) : 100;
+    int pop_size = argc > 3 ? std::atoi(argv[3]) : 30;
+    int warmup = rounds / 10;
+    long slack = 512;               // KB the allocator may still move after the warm-up
+
+    std::mt19937 rng(1);
+    long warm_rss = 0, peak_rss = 0;
+    {
+        std::vector<TourSnapshot> population, spares;
+        for (int i = 0; i < pop_size; ++i) population.emplace_back(makeTour(n, rng));
+        for (int round = 0; round < rounds; ++round) {
+            std::uniform_int_distribution<int> member(0, (int) population.size() - 1);
+            TourSnapshot offspring;
+            if (!spares.empty() && round % 2 == 0) {
+                // a spare is reset and rebuilt from a member, as Population reuses the rejected offspring
+                offspring = std::move(spares.back());
+                spares.pop_back();
+                List* s = offspring.edit();
+                s->reset();
+                List* parent = population[member(rng)];
+                Node* p = parent->head();
+                for (int i = 0; i < parent->size(); ++i, p = p->next) s->add(new Node(*p));
+                s->evaluate();
+            } else {
+                // a shared copy, edit() clones it before the moves
+                offspring = population[member(rng)];
+            }
+            mutate(offspring.edit(), rng);
+
+            if (round % 3 == 0) {
+                if (spares.size() < 4) spares.push_back(offspring);
+                continue;
+            }
+            population.push_back(offspring);
+            // the worst member dies, some handles to it may still be held by the spares
+            int worst = 0;
+            for (int i = 1; i < (int) population.size(); ++i) {
+                if (population[i]->getValue() > population[worst]->getValue()) worst = i;
+            }
+            population.erase(population.begin() + worst);
+
+            if (round == warmup) warm_rss = residentKB();
+            if (round > warmup) peak_rss = std::max(peak_rss, residentKB());
+        }
+    }
+
+    long live = Node::outstanding();
+    std::cout << "[SOAK] rounds: " << rounds << " rss after warm-up: " << warm_rss << " KB peak: " << peak_rss
+              << " KB nodes outstanding: " << live << std::endl;
+    int failed = 0;
+    if (peak_rss > warm_rss + slack) {
+        std::cerr << "[SOAK Error] the resident size grew by " << peak_rss - warm_rss << " KB after the warm-up" << std::endl;
+        ++failed;
+    }
+    if (live != 0) {
+        std::cerr << "[SOAK Error] " << live << " nodes were not deleted" << std::endl;
+        ++failed;
+    }
+    return failed == 0 ? 0 : 1;
+}
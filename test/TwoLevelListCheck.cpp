@@ -0,0 +1,101 @@
+/**
+ * TwoLevelListCheck.cpp
+ * created on : Oct 17 2026
+ **/
+
+// random reversals of a TwoLevelList against a plain array of the same tour. reverse may read the tour backwards
+// afterwards, so the two are compared as cycles: the same two neighbours for every id. next, prev, between and
+// tour must agree with each other in the orientation the list has
+// usage: TwoLevelListCheck <rounds> <largest tour size>
+
+#include "LocalSearch/TwoLevelList.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// the path a .. b of the array, in array direction
+static void reversePath(std::vector<int>& ref, std::vector<int>& pos, int a, int b) {
+    int n = ref.size(), first = pos[a], len = (pos[b] - first + n) % n + 1;
+    for (int k = 0; k < len / 2; ++k) {
+        int x = (first + k) % n, y = (first + len - 1 - k) % n;
+        std::swap(ref[x], ref[y]);
+        pos[ref[x]] = x;
+        pos[ref[y]] = y;
+    }
+}
+
+static int check(int n, int rounds, std::mt19937& rng) {
+    std::vector<int> ref(n), pos(n), out;
+    for (int i = 0; i < n; ++i) ref[i] = i;
+    std::shuffle(ref.begin(), ref.end(), rng);
+    for (int i = 0; i < n; ++i) pos[ref[i]] = i;
+    TwoLevelList list;
+    list.init(ref);
+
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    for (int round = 0; round < rounds; ++round) {
+        int a = pick(rng), b = pick(rng);
+        // short paths as in the 2-opt moves of SequenceOpt, and any path
+        if (round % 2 == 0) {
+            b = a;
+            for (int k = pick(rng) % 8; k > 0; --k) b = list.next(b);
+        }
+        // the path a .. b of the list runs from b to a in the array once the list reads it backwards
+        bool forward = n < 3 || list.next(ref[0]) == ref[1];
+        list.reverse(a, b);
+        if (forward) reversePath(ref, pos, a, b);
+        else reversePath(ref, pos, b, a);
+
+        for (int id = 0; id < n; ++id) {
+            int next = ref[(pos[id] + 1) % n], prev = ref[(pos[id] + n - 1) % n];
+            int ln = list.next(id), lp = list.prev(id);
+            if (!((ln == next && lp == prev) || (ln == prev && lp == next)) || list.prev(ln) != id) {
+                std::cerr << "[TWO LEVEL Error] size " << n << " round " << round << ": neighbours of " << id
+                          << " differ after reverse(" << a << ", " << b << ")" << std::endl;
+                return 1;
+            }
+        }
+
+        // between against a walk along next from a
+        int c = pick(rng), x = pick(rng);
+        bool seen = false;
+        for (int id = a;; id = list.next(id)) {
+            if (id == x) seen = true;
+            if (id == c) break;
+        }
+        if (list.between(a, x, c) != seen) {
+            std::cerr << "[TWO LEVEL Error] size " << n << " round " << round << ": between(" << a << ", " << x
+                      << ", " << c << ") is " << !seen << std::endl;
+            return 1;
+        }
+
+        if (round % 64 == 0) {
+            list.tour(out);
+            bool same = (int) out.size() == n;
+            for (int i = 0; same && i < n; ++i) same = list.next(out[i]) == out[(i + 1) % n];
+            if (!same) {
+                std::cerr << "[TWO LEVEL Error] size " << n << " round " << round << ": tour does not follow next"
+                          << std::endl;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    int rounds = argc > 1 ? std::atoi(argv[1]) : 20000;
+    int largest = argc > 2 ? std::atoi(argv[2]) : 1000;
+
+    std::mt19937 rng(1);
+    int failed = 0;
+    for (int n : {1, 2, 3, 4, 5, 8, 17, 64, 257, largest}) {
+        if (n > largest) continue;
+        failed += check(n, rounds, rng);
+    }
+    std::cout << "[TWO LEVEL] rounds: " << rounds << " largest size: " << largest << " failed sizes: " << failed
+              << std::endl;
+    return failed == 0 ? 0 : 1;
+}